@@ -0,0 +1,117 @@
+#include <bencode_context.h>
+#include <bencode_encoder.h>
+#include <bencode_hashed_dict.h>
+#include <bencode_parser.h>
+#include <bencode_patch.h>
+#include <bencode_segmented.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <iterator>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+#ifndef BENCODE_FUZZ_ENTRY_POINT
+    #error "BENCODE_FUZZ_ENTRY_POINT must name one of converter::bencode::details::Parse* functions"
+#endif
+
+namespace bencode = converter::bencode;
+namespace type_traits = bencode::type_traits;
+
+namespace {
+
+void Check(bool condition)
+{
+    if (!condition)
+    {
+        std::abort();
+    }
+}
+
+// Only parsing the fuzz input may throw; the result is empty then. Anything thrown later is a bug and aborts.
+template <typename Fn>
+auto TryParse(Fn&& fn) -> std::optional<decltype(fn())>
+{
+    try
+    {
+        return fn();
+    }
+    catch (const std::exception&)
+    {
+        return std::nullopt;
+    }
+}
+
+template <type_traits::BencodeTypeConcept T>
+void FuzzEntryPoint(std::string_view input)
+{
+    const auto result = TryParse([input] {
+        return bencode::details::BENCODE_FUZZ_ENTRY_POINT<T>(std::cbegin(input), std::cend(input));
+    });
+    if (!result)
+    {
+        return;
+    }
+
+    const auto& [it, value] = *result;
+    Check(std::distance(std::cbegin(input), it) > 0 && std::distance(it, std::cend(input)) >= 0);
+
+    const auto parsed = std::string_view(std::cbegin(input), it);
+    Check(bencode::details::Skip<T>(std::cbegin(parsed), std::cend(parsed)) == std::cend(parsed));
+
+    const auto encoded = bencode::Encode<T>(value);
+    Check(bencode::Encode<T>(bencode::Parse<T>(encoded)) == encoded);
+
+    const auto strict = bencode::Parse<T, bencode::DictPolicy::RejectUnsorted>(encoded);
+    Check(bencode::Encode<T>(strict) == encoded);
+}
+
+void FuzzSegmentedEntryPoint(std::string_view input)
+{
+    const std::string_view segments[] = {
+        input.substr(0, input.size() / 3), input.substr(input.size() / 3, input.size() / 3), input.substr(input.size() / 3 * 2)};
+    const bencode::SegmentedBuffer buffer{segments};
+
+    const auto result = TryParse([&buffer] {
+        const auto [it, value] = bencode::details::BENCODE_FUZZ_ENTRY_POINT<bencode::BaseTypeSegmented>(buffer.begin(), buffer.end());
+        return std::make_pair(it - buffer.begin(), bencode::Encode<bencode::BaseTypeSegmented>(value));
+    });
+    const auto expected = TryParse([input] {
+        const auto [it, value] = bencode::details::BENCODE_FUZZ_ENTRY_POINT<bencode::BaseTypeView>(std::cbegin(input), std::cend(input));
+        return std::make_pair(std::distance(std::cbegin(input), it), bencode::Encode<bencode::BaseTypeView>(value));
+    });
+
+    Check(result.has_value() == expected.has_value());
+    Check(!result || *result == *expected);
+}
+
+void FuzzParser(std::string_view input)
+{
+    static bencode::Parser parser;
+
+    const auto result = TryParse([input] {
+        return bencode::Encode<bencode::BaseTypeArena>(parser.Parse(input));
+    });
+    const auto expected = TryParse([input] {
+        return bencode::Encode<bencode::BaseTypeView>(bencode::Parse<bencode::BaseTypeView>(input));
+    });
+
+    Check(result == expected);
+}
+
+} // namespace
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size)
+{
+    const std::string_view input(reinterpret_cast<const char*>(data), size);
+
+    FuzzEntryPoint<bencode::BaseType>(input);
+    FuzzEntryPoint<bencode::BaseTypeView>(input);
+    FuzzEntryPoint<bencode::BaseTypeViewHashed>(input);
+    FuzzSegmentedEntryPoint(input);
+    FuzzParser(input);
+
+    return 0;
+}
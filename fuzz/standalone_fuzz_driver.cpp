@@ -0,0 +1,44 @@
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size);
+
+namespace {
+
+void RunInput(const std::filesystem::path& path)
+{
+    std::ifstream file(path, std::ios_base::in | std::ios_base::binary);
+    const std::string input{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+
+    LLVMFuzzerTestOneInput(reinterpret_cast<const uint8_t*>(input.data()), input.size());
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::filesystem::path path{argv[i]};
+        if (!std::filesystem::is_directory(path))
+        {
+            RunInput(path);
+            continue;
+        }
+
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(path))
+        {
+            if (entry.is_regular_file())
+            {
+                RunInput(entry.path());
+            }
+        }
+    }
+
+    std::cout << "Executed inputs without crashes" << std::endl;
+    return 0;
+}
@@ -0,0 +1,265 @@
+#pragma once
+
+#include <bencode_parser.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <memory_resource>
+#include <string_view>
+#include <vector>
+
+namespace converter::bencode {
+
+using BaseTypeArena = details::BencodeType<int64_t, std::string_view, std::pmr::vector, std::pmr::map>;
+using BenCodeVariantArena = type_traits::BencodeTypeTraits<BaseTypeArena>::Variant;
+
+class Arena final : public std::pmr::memory_resource
+{
+public:
+    static constexpr size_t DefaultChunkSize = 64 * 1024;
+
+    explicit Arena(size_t chunkSize = DefaultChunkSize)
+        : m_chunkSize(chunkSize)
+    {}
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    void Reset() noexcept
+    {
+        m_chunk = 0;
+        m_offset = 0;
+    }
+private:
+    struct Chunk
+    {
+        std::unique_ptr<std::byte[]> Data;
+        size_t Size{};
+    };
+
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+        for (; m_chunk < m_chunks.size(); ++m_chunk, m_offset = 0)
+        {
+            auto& chunk = m_chunks[m_chunk];
+
+            void* ptr = chunk.Data.get() + m_offset;
+            size_t space = chunk.Size - m_offset;
+            if (std::align(alignment, bytes, ptr, space))
+            {
+                m_offset = chunk.Size - space + bytes;
+                return ptr;
+            }
+        }
+
+        const size_t size = std::max(m_chunkSize, bytes + alignment);
+        m_chunks.push_back({std::make_unique<std::byte[]>(size), size});
+        m_chunk = m_chunks.size() - 1;
+        m_offset = 0;
+
+        return do_allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void*, size_t, size_t) override
+    {}
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+
+    size_t m_chunkSize{};
+    std::vector<Chunk> m_chunks{};
+    size_t m_chunk{};
+    size_t m_offset{};
+};
+
+// The result of Parse, with every string_view and container in it, is valid until the next Parse and
+// while data is alive. Copying it allocates from the default memory resource, not from the arena.
+template <DictPolicy Policy = DictPolicy::Accept>
+class Parser
+{
+public:
+    using Traits = type_traits::BencodeTypeTraits<BaseTypeArena>;
+    using Variant = BenCodeVariantArena;
+
+    explicit Parser(size_t arenaChunkSize = Arena::DefaultChunkSize)
+        : m_arena(arenaChunkSize)
+    {}
+
+    Parser(const Parser&) = delete;
+    Parser& operator=(const Parser&) = delete;
+
+    const Variant& Parse(std::string_view data)
+    {
+        Reset();
+
+        try
+        {
+            const auto end = std::cend(data);
+            auto it = std::cbegin(data);
+            do
+            {
+                if (it == end)
+                {
+                    throw std::invalid_argument("The value ended unexpectedly");
+                }
+
+                if (!m_stack.empty() && m_stack.back().IsDict && m_keys.size() - m_stack.back().FirstKey == ValueCount())
+                {
+                    it = *it == Traits::GetEndToken() ? CloseDict(it) : ParseKey(it, end);
+                }
+                else if (*it == Traits::GetIntToken())
+                {
+                    Traits::IntType value{};
+                    auto endIt = details::FromCanonicalChars(std::next(it), end, value);
+                    if (endIt == end || *endIt != Traits::GetEndToken())
+                    {
+                        throw std::invalid_argument("The int ended unexpectedly");
+                    }
+
+                    m_values.emplace_back(Variant{value});
+                    it = std::next(endIt);
+                }
+                else if (*it == Traits::GetStrToken())
+                {
+                    const auto [payloadIt, endIt] = details::ScanString<BaseTypeArena>(it, end);
+                    m_values.emplace_back(Variant{Traits::StrType{payloadIt, endIt}});
+                    it = endIt;
+                }
+                else if (*it == Traits::GetListToken() || *it == Traits::GetDictToken())
+                {
+                    details::CheckNestingDepth(m_stack.size() + 1);
+                    m_stack.push_back({*it == Traits::GetDictToken(), m_values.size(), m_keys.size()});
+                    ++it;
+                }
+                else if (*it == Traits::GetEndToken() && !m_stack.empty())
+                {
+                    it = CloseList(it);
+                }
+                else
+                {
+                    throw std::invalid_argument(Format("Unexpected symbol: {}", *it));
+                }
+            } while (!m_stack.empty());
+
+            if (it != end)
+            {
+                throw std::invalid_argument(Format("Unparsed data starts with {}", std::distance(std::cbegin(data), it)));
+            }
+
+            return m_values.back().AsVariant();
+        }
+        catch (...)
+        {
+            Reset();
+            std::throw_with_nested(std::runtime_error(
+                Format("{}:{}:Failed to parse Bencode value: {}", __FUNCTION__, __LINE__, Excerpt(std::cbegin(data), std::cend(data)))));
+        }
+    }
+private:
+    struct Frame
+    {
+        bool IsDict = false;
+        size_t FirstValue{};
+        size_t FirstKey{};
+    };
+
+    void Reset() noexcept
+    {
+        m_values.clear();
+        m_keys.clear();
+        m_stack.clear();
+        m_arena.Reset();
+    }
+
+    size_t ValueCount() const noexcept
+    {
+        return m_values.size() - m_stack.back().FirstValue;
+    }
+
+    std::string_view::const_iterator ParseKey(std::string_view::const_iterator it, std::string_view::const_iterator end)
+    {
+        const auto [keyBegin, keyEnd] = details::ScanString<BaseTypeArena>(it, end);
+        const auto key = Traits::StrType{keyBegin, keyEnd};
+
+        if constexpr (Policy == DictPolicy::RejectUnsorted)
+        {
+            const bool hasPrevKey = m_keys.size() != m_stack.back().FirstKey;
+            if (hasPrevKey && !details::KeyLess(std::cbegin(m_keys.back()), std::cend(m_keys.back()), keyBegin, keyEnd))
+            {
+                throw std::invalid_argument(Format("The key '{}' is not greater than the previous key '{}'", key, m_keys.back()));
+            }
+        }
+
+        m_keys.push_back(key);
+        return keyEnd;
+    }
+
+    std::string_view::const_iterator CloseList(std::string_view::const_iterator it)
+    {
+        const auto frame = m_stack.back();
+        if (frame.IsDict)
+        {
+            throw std::invalid_argument(Format("The dict ended after the key '{}'", m_keys.back()));
+        }
+
+        Traits::ListType list{&m_arena};
+        list.reserve(ValueCount());
+        std::move(std::next(std::begin(m_values), frame.FirstValue), std::end(m_values), std::back_inserter(list));
+
+        Close(frame, Variant{std::move(list)});
+        return std::next(it);
+    }
+
+    std::string_view::const_iterator CloseDict(std::string_view::const_iterator it)
+    {
+        const auto frame = m_stack.back();
+
+        Traits::DictType dict{&m_arena};
+        for (size_t i = 0; i < m_keys.size() - frame.FirstKey; ++i)
+        {
+            const auto& key = m_keys[frame.FirstKey + i];
+            auto& value = m_values[frame.FirstValue + i];
+            if constexpr (Policy == DictPolicy::Accept || Policy == DictPolicy::RejectUnsorted)
+            {
+                dict.try_emplace(key, std::move(value));
+            }
+            else
+            {
+                auto [itemIt, inserted] = dict.try_emplace(key, std::move(value));
+                if constexpr (Policy == DictPolicy::RejectDuplicates)
+                {
+                    if (!inserted)
+                    {
+                        throw std::invalid_argument(Format("Duplicate key '{}'", key));
+                    }
+                }
+                else if (!inserted)
+                {
+                    itemIt->second = std::move(value);
+                }
+            }
+        }
+
+        m_keys.resize(frame.FirstKey);
+        Close(frame, Variant{std::move(dict)});
+        return std::next(it);
+    }
+
+    void Close(const Frame& frame, Variant&& value)
+    {
+        m_values.erase(std::next(std::begin(m_values), frame.FirstValue), std::end(m_values));
+        m_values.emplace_back(std::move(value));
+        m_stack.pop_back();
+    }
+
+    Arena m_arena;
+    std::vector<Frame> m_stack{};
+    std::vector<BaseTypeArena> m_values{};
+    std::vector<Traits::StrType> m_keys{};
+};
+
+} // namespace converter::bencode
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <bencode_parser.h>
+
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <variant>
+
+namespace converter::bencode {
+
+namespace details {
+
+template <type_traits::BencodeTypeConcept T, std::output_iterator<char> O>
+O EncodeString(std::string_view value, O out)
+{
+    auto it = fmt::format_to(out, "{}{}", std::size(value), type_traits::BencodeTypeTraits<T>::GetSepToken().Token);
+    return std::copy(std::cbegin(value), std::cend(value), it);
+}
+
+} // namespace details
+
+template <type_traits::BencodeTypeConcept T, std::output_iterator<char> O>
+O Encode(const typename type_traits::BencodeTypeTraits<T>::Variant& value, O out)
+{
+    using Traits = type_traits::BencodeTypeTraits<T>;
+
+    return std::visit(
+        [&out]<typename V>(const V& item) -> O {
+            if constexpr (std::same_as<V, typename Traits::IntType>)
+            {
+                return fmt::format_to(out, "{}{}{}", Traits::GetIntToken().Token, item, Traits::GetEndToken().Token);
+            }
+            else if constexpr (std::same_as<V, typename Traits::StrType>)
+            {
+                return details::EncodeString<T>(item, out);
+            }
+            else if constexpr (std::same_as<V, typename Traits::ListType>)
+            {
+                auto it = fmt::format_to(out, "{}", Traits::GetListToken().Token);
+                for (const auto& element : item)
+                {
+                    it = Encode<T>(element.AsVariant(), it);
+                }
+
+                return fmt::format_to(it, "{}", Traits::GetEndToken().Token);
+            }
+            else
+            {
+                auto it = fmt::format_to(out, "{}", Traits::GetDictToken().Token);
+                for (const auto& [key, element] : item)
+                {
+                    it = details::EncodeString<T>(key, it);
+                    it = Encode<T>(element.AsVariant(), it);
+                }
+
+                return fmt::format_to(it, "{}", Traits::GetEndToken().Token);
+            }
+        },
+        value);
+}
+
+template <type_traits::BencodeTypeConcept T>
+std::string Encode(const typename type_traits::BencodeTypeTraits<T>::Variant& value)
+{
+    std::string result;
+    Encode<T>(value, std::back_inserter(result));
+
+    return result;
+}
+
+} // namespace converter::bencode
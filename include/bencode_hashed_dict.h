@@ -0,0 +1,269 @@
+#pragma once
+
+#include <bencode_parser.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace converter::bencode {
+
+constexpr uint32_t HashKey(std::string_view key) noexcept
+{
+    uint32_t hash = 2166136261u;
+    for (char ch : key)
+    {
+        hash ^= static_cast<unsigned char>(ch);
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+// A dict key whose hash is computed at compile time, e.g. dict.Find("info_hash").
+// The hash only speeds up dicts of up to HashedDict::LinearScanLimit items; larger ones are searched by key.
+struct KeyConstant
+{
+    template <size_t N>
+    consteval KeyConstant(const char (&key)[N]) noexcept
+        : Key(key, N - 1)
+        , Hash(HashKey(Key))
+    {}
+
+    std::string_view Key;
+    uint32_t Hash{};
+};
+
+// Sorted dict items with each key's hash stored next to it. Keys that arrive in order are appended,
+// other keys are inserted at their sorted position in O(n). Between DeferSorting() and Seal(), which
+// ParseDict calls around a dict, out-of-order keys are appended and tracked by a map index instead,
+// so parsing any dict is O(n log n) and the dict is sorted again once it is closed.
+template <typename K, typename V>
+class HashedDict
+{
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = std::pair<const K, V>;
+    using size_type = size_t;
+    using iterator = typename std::vector<value_type>::iterator;
+    using const_iterator = typename std::vector<value_type>::const_iterator;
+
+    static constexpr size_t LinearScanLimit = 16;
+
+    iterator begin() noexcept
+    {
+        return m_items.begin();
+    }
+
+    iterator end() noexcept
+    {
+        return m_items.end();
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return m_items.begin();
+    }
+
+    const_iterator end() const noexcept
+    {
+        return m_items.end();
+    }
+
+    size_t size() const noexcept
+    {
+        return m_items.size();
+    }
+
+    bool empty() const noexcept
+    {
+        return m_items.empty();
+    }
+
+    iterator find(std::string_view key) noexcept
+    {
+        return std::next(begin(), IndexOf(key, HashKey(key)));
+    }
+
+    const_iterator find(std::string_view key) const noexcept
+    {
+        return std::next(begin(), IndexOf(key, HashKey(key)));
+    }
+
+    const_iterator Find(KeyConstant key) const noexcept
+    {
+        return std::next(begin(), IndexOf(key.Key, key.Hash));
+    }
+
+    bool contains(std::string_view key) const noexcept
+    {
+        return find(key) != end();
+    }
+
+    const V& at(std::string_view key) const
+    {
+        const auto it = find(key);
+        if (it == end())
+        {
+            throw std::out_of_range("HashedDict::at: key not found");
+        }
+
+        return it->second;
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(K key, Args&&... args)
+    {
+        if (m_index.empty() && !m_items.empty() && !(m_items.back().first < key))
+        {
+            if (m_items.back().first == key)
+            {
+                return {std::prev(end()), false};
+            }
+
+            if (!m_deferred)
+            {
+                return InsertSorted(std::move(key), std::forward<Args>(args)...);
+            }
+
+            for (size_t i = 0; i < m_items.size(); ++i)
+            {
+                m_index.emplace(m_items[i].first, i);
+            }
+        }
+
+        auto hint = std::end(m_index);
+        if (!m_index.empty())
+        {
+            hint = m_index.lower_bound(key);
+            if (hint != std::end(m_index) && hint->first == key)
+            {
+                return {std::next(begin(), hint->second), false};
+            }
+        }
+
+        m_hashes.push_back(HashKey(key));
+        m_items.emplace_back(
+            std::piecewise_construct, std::forward_as_tuple(std::move(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+        if (!m_index.empty())
+        {
+            m_index.emplace_hint(hint, m_items.back().first, m_items.size() - 1);
+        }
+
+        return {std::prev(end()), true};
+    }
+
+    std::pair<iterator, bool> insert(value_type&& item)
+    {
+        return try_emplace(item.first, std::move(item.second));
+    }
+
+    std::pair<iterator, bool> insert(const value_type& item)
+    {
+        return try_emplace(item.first, item.second);
+    }
+
+    void DeferSorting() noexcept
+    {
+        m_deferred = true;
+    }
+
+    void Seal()
+    {
+        m_deferred = false;
+        if (m_index.empty())
+        {
+            return;
+        }
+
+        std::vector<uint32_t> hashes;
+        std::vector<value_type> items;
+        hashes.reserve(m_items.size());
+        items.reserve(m_items.size());
+        for (const auto& [key, index] : m_index)
+        {
+            hashes.push_back(m_hashes[index]);
+            items.push_back(std::move(m_items[index]));
+        }
+
+        m_hashes = std::move(hashes);
+        m_items = std::move(items);
+        m_index.clear();
+    }
+private:
+    template <typename... Args>
+    std::pair<iterator, bool> InsertSorted(K key, Args&&... args)
+    {
+        const auto it = std::lower_bound(std::begin(m_items), std::end(m_items), key, [](const value_type& item, const K& value) {
+            return item.first < value;
+        });
+
+        if (it->first == key)
+        {
+            return {it, false};
+        }
+
+        // The keys are const, so the items are rebuilt around the new one instead of shifted.
+        const auto index = static_cast<size_t>(std::distance(std::begin(m_items), it));
+        m_hashes.reserve(m_hashes.size() + 1);
+
+        std::vector<value_type> items;
+        items.reserve(m_items.size() + 1);
+        std::move(std::begin(m_items), it, std::back_inserter(items));
+        items.emplace_back(
+            std::piecewise_construct, std::forward_as_tuple(std::move(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+        std::move(it, std::end(m_items), std::back_inserter(items));
+
+        m_hashes.insert(std::next(std::begin(m_hashes), index), HashKey(items[index].first));
+        m_items = std::move(items);
+
+        return {std::next(begin(), index), true};
+    }
+
+    // Only dicts of up to LinearScanLimit items compare the stored hashes; larger ones are searched by key.
+    size_t IndexOf(std::string_view key, uint32_t hash) const noexcept
+    {
+        if (m_items.size() <= LinearScanLimit)
+        {
+            for (size_t i = 0; i < m_hashes.size(); ++i)
+            {
+                if (m_hashes[i] == hash && std::string_view{m_items[i].first} == key)
+                {
+                    return i;
+                }
+            }
+
+            return m_items.size();
+        }
+
+        if (!m_index.empty())
+        {
+            const auto it = m_index.find(K{key});
+            return it != std::end(m_index) ? it->second : m_items.size();
+        }
+
+        const auto it = std::lower_bound(std::begin(m_items), std::end(m_items), key, [](const value_type& item, std::string_view value) {
+            return std::string_view{item.first} < value;
+        });
+
+        return it != std::end(m_items) && std::string_view{it->first} == key ? std::distance(std::begin(m_items), it) : m_items.size();
+    }
+
+    std::vector<uint32_t> m_hashes{};
+    std::vector<value_type> m_items{};
+    std::map<K, size_t> m_index{};
+    bool m_deferred = false;
+};
+
+using BaseTypeViewHashed = details::BencodeType<int64_t, std::string_view, std::vector, HashedDict>;
+using BenCodeVariantViewHashed = type_traits::BencodeTypeTraits<BaseTypeViewHashed>::Variant;
+
+} // namespace converter::bencode
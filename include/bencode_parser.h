@@ -3,10 +3,18 @@
 #include <fmt/format.h>
 
 #include <algorithm>
+#include <array>
+#include <bitset>
 #include <charconv>
 #include <concepts>
 #include <exception>
+#include <iterator>
+#include <limits>
 #include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
 #include <variant>
 #include <vector>
 
@@ -18,19 +26,6 @@ constexpr std::convertible_to<std::string_view> auto Format(fmt::format_string<A
     return fmt::format(pattern, std::forward<Args>(args)...);
 }
 
-template <std::forward_iterator It, typename T>
-It FromChars(It begin, It end, T& result)
-{
-    std::string_view tmp{begin, end};
-    auto [it, error] = std::from_chars(tmp.data(), tmp.data() + tmp.size(), result);
-    if (error != std::errc())
-    {
-        throw std::system_error(std::make_error_code(error));
-    }
-
-    return std::next(begin, std::distance(&*begin, &*it));
-}
-
 namespace type_traits {
 
 constexpr char InvalidSymbol = '\0';
@@ -65,6 +60,17 @@ concept BencodeDictConcept = requires(T dict)
     dict.insert(std::declval<typename T::value_type>());
 };
 
+template <typename It>
+concept SegmentedIteratorConcept = requires(It it, size_t count) {
+    requires std::forward_iterator<It>;
+    requires std::sized_sentinel_for<It, It>;
+
+    {
+        it.Segment()
+        } -> std::same_as<std::string_view>;
+    it.Advance(count);
+};
+
 template <typename Token>
 concept HasTokenType = requires { typename Token::Type; };
 
@@ -185,6 +191,88 @@ struct BencodeTypeTraits
 
 } // namespace type_traits
 
+template <std::forward_iterator It, typename T>
+It FromChars(It begin, It end, T& result)
+{
+    if constexpr (std::contiguous_iterator<It>)
+    {
+        const char* first = std::to_address(begin);
+        auto [it, error] = std::from_chars(first, first + std::distance(begin, end), result);
+        if (error != std::errc())
+        {
+            throw std::system_error(std::make_error_code(error));
+        }
+
+        return std::next(begin, std::distance(first, it));
+    }
+    else
+    {
+        if constexpr (type_traits::SegmentedIteratorConcept<It>)
+        {
+            const auto segment = begin.Segment().substr(0, static_cast<size_t>(end - begin));
+            auto [it, error] = std::from_chars(segment.data(), segment.data() + segment.size(), result);
+            if (error == std::errc() && it != segment.data() + segment.size())
+            {
+                begin.Advance(static_cast<size_t>(it - segment.data()));
+                return begin;
+            }
+        }
+
+        std::array<char, std::numeric_limits<T>::digits10 + 3> buffer{};
+        auto last = begin;
+        size_t size{};
+        for (; last != end && size < buffer.size(); ++last)
+        {
+            buffer[size++] = *last;
+        }
+
+        const char* first = buffer.data();
+        auto [it, error] = std::from_chars(first, first + size, result);
+        if (error == std::errc() && it == first + buffer.size() && last != end && std::isdigit(static_cast<unsigned char>(*last)))
+        {
+            error = std::errc::result_out_of_range;
+        }
+
+        if (error != std::errc())
+        {
+            throw std::system_error(std::make_error_code(error));
+        }
+
+        return std::next(begin, std::distance(first, it));
+    }
+}
+
+template <std::forward_iterator It>
+auto Excerpt(It begin, It end)
+{
+    constexpr size_t MaxExcerptSize = 64;
+    if constexpr (std::contiguous_iterator<It>)
+    {
+        return std::string_view(begin, end).substr(0, MaxExcerptSize);
+    }
+    else
+    {
+        std::string result;
+        for (; begin != end && result.size() < MaxExcerptSize; ++begin)
+        {
+            result.push_back(*begin);
+        }
+
+        return result;
+    }
+}
+
+enum class DictPolicy
+{
+    Accept,
+    RejectDuplicates,
+    RejectUnsorted,
+    LastWins
+};
+
+// Lists and dicts nested deeper than this are rejected before the parser runs out of stack.
+inline constexpr size_t MaxNestingDepth = 256;
+
 namespace details {
 
 template <typename I, typename S, template <typename...> typename L, template <typename...> typename D>
@@ -214,7 +302,7 @@ public:
         return m_variant;
     }
 
-    Variant AsVariant() const&
+    const Variant& AsVariant() const&
     {
         return m_variant;
     }
@@ -227,6 +315,90 @@ private:
     std::variant<Int, Str, List, Dict> m_variant{};
 };
 
+template <std::forward_iterator It>
+It NextWithin(It it, size_t count, It end)
+{
+    if constexpr (std::sized_sentinel_for<It, It>)
+    {
+        if (static_cast<size_t>(end - it) < count)
+        {
+            throw std::invalid_argument("Incomplete payload");
+        }
+
+        if constexpr (type_traits::SegmentedIteratorConcept<It>)
+        {
+            it.Advance(count);
+            return it;
+        }
+        else
+        {
+            return std::next(it, count);
+        }
+    }
+    else
+    {
+        for (; count != 0; --count, ++it)
+        {
+            if (it == end)
+            {
+                throw std::invalid_argument("Incomplete payload");
+            }
+        }
+
+        return it;
+    }
+}
+
+template <std::forward_iterator L, std::forward_iterator R>
+bool KeyLess(L lhsBegin, L lhsEnd, R rhsBegin, R rhsEnd)
+{
+    return std::lexicographical_compare(lhsBegin, lhsEnd, rhsBegin, rhsEnd, [](char lhs, char rhs) {
+        return static_cast<unsigned char>(lhs) < static_cast<unsigned char>(rhs);
+    });
+}
+
+// Bencode has a single encoding per number, so leading zeros and negative zero are rejected.
+template <std::forward_iterator It, typename T>
+It FromCanonicalChars(It begin, It end, T& result)
+{
+    const auto last = FromChars(begin, end, result);
+
+    auto it = begin;
+    if (*it == '-')
+    {
+        ++it;
+    }
+
+    if (*it == '0' && (it != begin || std::next(it) != last))
+    {
+        throw std::invalid_argument(Format("Non-canonical number: {}", Excerpt(begin, last)));
+    }
+
+    return last;
+}
+
+inline void CheckNestingDepth(size_t depth)
+{
+    if (depth > MaxNestingDepth)
+    {
+        throw std::invalid_argument(Format("The nesting depth exceeds {}", MaxNestingDepth));
+    }
+}
+
+template <type_traits::BencodeTypeConcept T, std::forward_iterator It>
+std::pair<It, It> ScanString(It begin, It end)
+{
+    size_t sizeOf{};
+    auto sepIt = FromCanonicalChars(begin, end, sizeOf);
+    if (sepIt == end || *sepIt != type_traits::BencodeTypeTraits<T>::GetSepToken())
+    {
+        throw std::invalid_argument("Separate token not found");
+    }
+
+    auto payloadIt = std::next(sepIt);
+    return std::make_pair(payloadIt, NextWithin(payloadIt, sizeOf, end));
+}
+
 template <type_traits::BencodeTypeConcept T, std::forward_iterator It>
 std::pair<It, typename type_traits::BencodeTypeTraits<T>::Variant> ParseInt(It begin, It end)
 {
@@ -243,29 +415,19 @@ std::pair<It, typename type_traits::BencodeTypeTraits<T>::Variant> ParseInt(It b
             throw std::invalid_argument(Format("Expected the first letter '{}', actually: {}", IntToken.Token, *begin));
         }
 
-        constexpr auto IsDigit = [](auto ch) -> bool {
-            return std::isdigit(ch);
-        };
-
-        auto firstDigit = std::find_if(begin, end, IsDigit);
-        if (firstDigit == end)
-        {
-            throw std::invalid_argument("Expected at least one digit, actualy - digit not found");
-        }
-
         typename type_traits::BencodeTypeTraits<T>::IntType result{};
-        auto it = FromChars(firstDigit, end, result);
+        auto it = FromCanonicalChars(std::next(begin), end, result);
         if (it == end || *it != type_traits::BencodeTypeTraits<T>::GetEndToken())
         {
             throw std::invalid_argument("The int ended unexpectedly");
         }
 
-        return std::make_pair(std::next(it), T{std::move(result)});
+        return std::make_pair(std::next(it), typename type_traits::BencodeTypeTraits<T>::Variant{std::move(result)});
     }
     catch (...)
     {
         std::throw_with_nested(
-            std::runtime_error(Format("{}:{}:Failed to parse int value: {}", __FUNCTION__, __LINE__, std::string_view(begin, end))));
+            std::runtime_error(Format("{}:{}:Failed to parse int value: {}", __FUNCTION__, __LINE__, Excerpt(begin, end))));
     }
 }
 
@@ -280,7 +442,7 @@ std::pair<It, typename type_traits::BencodeTypeTraits<T>::Variant> ParseString(I
         }
 
         size_t sizeOf{};
-        auto sepIt = FromChars(begin, end, sizeOf);
+        auto sepIt = FromCanonicalChars(begin, end, sizeOf);
 
         if (sepIt == end)
         {
@@ -293,26 +455,22 @@ std::pair<It, typename type_traits::BencodeTypeTraits<T>::Variant> ParseString(I
             throw std::invalid_argument(Format("Expected '{}' token, actually: {}", SepToken.Token, *sepIt));
         }
 
-        auto endIt = std::next(sepIt, sizeOf + 1);
-        if (endIt > end)
-        {
-            throw std::invalid_argument(Format("Incomplete payload"));
-        }
-
-        return std::make_pair(endIt, typename type_traits::BencodeTypeTraits<T>::StrType{std::next(sepIt), endIt});
+        auto payloadIt = std::next(sepIt);
+        auto endIt = NextWithin(payloadIt, sizeOf, end);
+        return std::make_pair(endIt, typename type_traits::BencodeTypeTraits<T>::StrType{payloadIt, endIt});
     }
     catch (...)
     {
         std::throw_with_nested(
-            std::runtime_error(Format("{}:{}:Failed to parse string value: {}", __FUNCTION__, __LINE__, std::string_view(begin, end))));
+            std::runtime_error(Format("{}:{}:Failed to parse string value: {}", __FUNCTION__, __LINE__, Excerpt(begin, end))));
     }
 }
 
-template <type_traits::BencodeTypeConcept T, std::forward_iterator It>
-std::pair<It, typename type_traits::BencodeTypeTraits<T>::Variant> Parse(It begin, It end);
+template <type_traits::BencodeTypeConcept T, DictPolicy Policy = DictPolicy::Accept, std::forward_iterator It>
+std::pair<It, typename type_traits::BencodeTypeTraits<T>::Variant> Parse(It begin, It end, size_t depth = 0);
 
-template <type_traits::BencodeTypeConcept T, std::forward_iterator It>
-std::pair<It, typename type_traits::BencodeTypeTraits<T>::Variant> ParseList(It begin, It end)
+template <type_traits::BencodeTypeConcept T, DictPolicy Policy = DictPolicy::Accept, std::forward_iterator It>
+std::pair<It, typename type_traits::BencodeTypeTraits<T>::Variant> ParseList(It begin, It end, size_t depth = 0)
 {
     try
     {
@@ -325,38 +483,41 @@ std::pair<It, typename type_traits::BencodeTypeTraits<T>::Variant> ParseList(It
         if (*begin != ListToken)
         {
             throw std::invalid_argument(
-                Format("Expected the first letter '{}', actually {}", ListToken.Token, std::string_view(begin, end)));
+                Format("Expected the first letter '{}', actually {}", ListToken.Token, Excerpt(begin, end)));
         }
 
+        CheckNestingDepth(++depth);
+
         type_traits::BencodeListConcept auto list = typename type_traits::BencodeTypeTraits<T>::ListType{};
 
         auto outputIt = std::back_inserter(list);
 
+        constexpr type_traits::TokenConcept auto EndToken = type_traits::BencodeTypeTraits<T>::GetEndToken();
+
         auto it = std::next(begin);
-        if (it == end)
+        while (it != end && *it != EndToken)
         {
-            throw std::invalid_argument("The list ended unexpectedly");
+            auto [endIt, value] = Parse<T, Policy>(it, end, depth);
+            *outputIt = std::move(value);
+            it = endIt;
         }
 
-        constexpr type_traits::TokenConcept auto EndToken = type_traits::BencodeTypeTraits<T>::GetEndToken();
-        while (*it != EndToken)
+        if (it == end)
         {
-            auto [endIt, value] = Parse<T>(it, end);
-            *outputIt = std::move(value);
-            it = endIt;
+            throw std::invalid_argument("The list ended unexpectedly");
         }
 
-        return std::make_pair(end, T{list});
+        return std::make_pair(std::next(it), std::move(list));
     }
     catch (...)
     {
         std::throw_with_nested(
-            std::runtime_error(Format("{}:{}:Failed to parse list value: {}", __FUNCTION__, __LINE__, std::string_view(begin, end))));
+            std::runtime_error(Format("{}:{}:Failed to parse list value: {}", __FUNCTION__, __LINE__, Excerpt(begin, end))));
     }
 }
 
-template <type_traits::BencodeTypeConcept T, std::forward_iterator It>
-std::pair<It, typename type_traits::BencodeTypeTraits<T>::Variant> ParseDict(It begin, It end)
+template <type_traits::BencodeTypeConcept T, DictPolicy Policy = DictPolicy::Accept, std::forward_iterator It>
+std::pair<It, typename type_traits::BencodeTypeTraits<T>::Variant> ParseDict(It begin, It end, size_t depth = 0)
 {
     try
     {
@@ -369,36 +530,85 @@ std::pair<It, typename type_traits::BencodeTypeTraits<T>::Variant> ParseDict(It
         if (*begin != DictToken)
         {
             throw std::invalid_argument(
-                Format("Expected the first letter '{}', actually {}", DictToken.Token, std::string_view(begin, end)));
+                Format("Expected the first letter '{}', actually {}", DictToken.Token, Excerpt(begin, end)));
         }
 
+        CheckNestingDepth(++depth);
+
         type_traits::BencodeDictConcept auto dict = typename type_traits::BencodeTypeTraits<T>::DictType{};
+        if constexpr (requires { dict.DeferSorting(); })
+        {
+            dict.DeferSorting();
+        }
 
         constexpr type_traits::TokenConcept auto EndToken = type_traits::BencodeTypeTraits<T>::GetEndToken();
 
-        std::advance(begin, 1);
-        while (*begin != EndToken)
+        std::optional<std::pair<It, It>> prevKey{};
+
+        auto it = std::next(begin);
+        while (it != end && *it != EndToken)
         {
-            const auto [keyEndIt, keyVariant] = ParseString<T>(begin, end);
-            const auto [valueEndIt, valueVariant] = Parse<T>(keyEndIt, end);
+            const auto [keyBegin, keyEnd] = ScanString<T>(it, end);
+            if constexpr (Policy == DictPolicy::RejectUnsorted)
+            {
+                if (prevKey && !KeyLess(prevKey->first, prevKey->second, keyBegin, keyEnd))
+                {
+                    throw std::invalid_argument(Format(
+                        "The key '{}' is not greater than the previous key '{}'",
+                        Excerpt(keyBegin, keyEnd),
+                        Excerpt(prevKey->first, prevKey->second)));
+                }
+
+                prevKey.emplace(keyBegin, keyEnd);
+            }
+
+            auto [valueEndIt, valueVariant] = Parse<T, Policy>(keyEnd, end, depth);
+
+            typename type_traits::BencodeTypeTraits<T>::StrType key{keyBegin, keyEnd};
+            if constexpr (Policy == DictPolicy::Accept || Policy == DictPolicy::RejectUnsorted)
+            {
+                dict.insert(std::pair<typename type_traits::BencodeTypeTraits<T>::StrType, T>(std::move(key), std::move(valueVariant)));
+            }
+            else
+            {
+                auto [itemIt, inserted] = dict.try_emplace(std::move(key), std::move(valueVariant));
+                if constexpr (Policy == DictPolicy::RejectDuplicates)
+                {
+                    if (!inserted)
+                    {
+                        throw std::invalid_argument(Format("Duplicate key '{}'", Excerpt(keyBegin, keyEnd)));
+                    }
+                }
+                else if (!inserted)
+                {
+                    itemIt->second = std::move(valueVariant);
+                }
+            }
+
+            it = valueEndIt;
+        }
 
-            dict.insert(std::pair<typename type_traits::BencodeTypeTraits<T>::StrType, T>(
-                std::get<typename type_traits::BencodeTypeTraits<T>::StrType>(keyVariant), valueVariant));
+        if (it == end)
+        {
+            throw std::invalid_argument("The dict ended unexpectedly");
+        }
 
-            begin = valueEndIt;
+        if constexpr (requires { dict.Seal(); })
+        {
+            dict.Seal();
         }
 
-        return std::make_pair(std::next(begin), std::move(dict));
+        return std::make_pair(std::next(it), std::move(dict));
     }
     catch (...)
     {
         std::throw_with_nested(
-            std::runtime_error(Format("{}:{}:Failed to parse dict value: {}", __FUNCTION__, __LINE__, std::string_view(begin, end))));
+            std::runtime_error(Format("{}:{}:Failed to parse dict value: {}", __FUNCTION__, __LINE__, Excerpt(begin, end))));
     }
 }
 
-template <type_traits::BencodeTypeConcept T, std::forward_iterator It>
-std::pair<It, typename type_traits::BencodeTypeTraits<T>::Variant> Parse(It begin, It end)
+template <type_traits::BencodeTypeConcept T, DictPolicy Policy, std::forward_iterator It>
+std::pair<It, typename type_traits::BencodeTypeTraits<T>::Variant> Parse(It begin, It end, size_t depth)
 {
     try
     {
@@ -414,12 +624,12 @@ std::pair<It, typename type_traits::BencodeTypeTraits<T>::Variant> Parse(It begi
 
         if (*begin == type_traits::BencodeTypeTraits<T>::GetListToken())
         {
-            return ParseList<T>(begin, end);
+            return ParseList<T, Policy>(begin, end, depth);
         }
 
         if (*begin == type_traits::BencodeTypeTraits<T>::GetDictToken())
         {
-            return ParseDict<T>(begin, end);
+            return ParseDict<T, Policy>(begin, end, depth);
         }
 
         if (*begin == type_traits::BencodeTypeTraits<T>::GetStrToken())
@@ -432,7 +642,98 @@ std::pair<It, typename type_traits::BencodeTypeTraits<T>::Variant> Parse(It begi
     catch (...)
     {
         std::throw_with_nested(
-            std::runtime_error(Format("{}:{}:Failed to parse Bencode value: {}", __FUNCTION__, __LINE__, std::string_view(begin, end))));
+            std::runtime_error(Format("{}:{}:Failed to parse Bencode value: {}", __FUNCTION__, __LINE__, Excerpt(begin, end))));
+    }
+}
+
+template <type_traits::BencodeTypeConcept T, std::forward_iterator It>
+It SkipInt(It begin, It end)
+{
+    typename type_traits::BencodeTypeTraits<T>::IntType result{};
+    auto it = FromCanonicalChars(std::next(begin), end, result);
+    if (it == end || *it != type_traits::BencodeTypeTraits<T>::GetEndToken())
+    {
+        throw std::invalid_argument("The int ended unexpectedly");
+    }
+
+    return std::next(it);
+}
+
+template <type_traits::BencodeTypeConcept T, std::forward_iterator It>
+It Skip(It begin, It end)
+{
+    try
+    {
+        using Traits = type_traits::BencodeTypeTraits<T>;
+
+        // Per nesting level: whether it is a dict. Inside a dict, keyPending tells a value from a key.
+        std::bitset<MaxNestingDepth + 1> isDict{};
+        bool keyPending = false;
+
+        size_t depth{};
+        auto it = begin;
+        do
+        {
+            if (it == end)
+            {
+                throw std::invalid_argument("The value ended unexpectedly");
+            }
+
+            if (isDict[depth] && !keyPending)
+            {
+                if (*it == Traits::GetEndToken())
+                {
+                    --depth;
+                    ++it;
+                }
+                else if (*it == Traits::GetStrToken())
+                {
+                    it = ScanString<T>(it, end).second;
+                    keyPending = true;
+                    continue;
+                }
+                else
+                {
+                    throw std::invalid_argument(Format("Expected a string key, actually: {}", *it));
+                }
+            }
+            else if (*it == Traits::GetIntToken())
+            {
+                it = SkipInt<T>(it, end);
+            }
+            else if (*it == Traits::GetStrToken())
+            {
+                it = ScanString<T>(it, end).second;
+            }
+            else if (*it == Traits::GetListToken() || *it == Traits::GetDictToken())
+            {
+                CheckNestingDepth(++depth);
+                isDict[depth] = *it == Traits::GetDictToken();
+                ++it;
+            }
+            else if (*it == Traits::GetEndToken() && depth != 0 && !isDict[depth])
+            {
+                --depth;
+                ++it;
+            }
+            else if (*it == Traits::GetEndToken() && keyPending)
+            {
+                throw std::invalid_argument("The dict ended after a key");
+            }
+            else
+            {
+                throw std::invalid_argument(Format("Unexpected symbol: {}", *it));
+            }
+
+            keyPending = false;
+        } while (depth != 0);
+
+        return it;
+    }
+    catch (...)
+    {
+        std::throw_with_nested(
+            std::runtime_error(Format("{}:{}:Failed to skip Bencode value: {}", __FUNCTION__, __LINE__, Excerpt(begin, end))));
     }
 }
 
@@ -443,14 +744,14 @@ using BaseTypeView = details::BencodeType<int64_t, std::string_view, std::vector
 using BenCodeVariant = type_traits::BencodeTypeTraits<BaseType>::Variant;
 using BenCodeVariantView = type_traits::BencodeTypeTraits<BaseTypeView>::Variant;
 
-template <type_traits::BencodeTypeConcept T>
+template <type_traits::BencodeTypeConcept T, DictPolicy Policy = DictPolicy::Accept>
 type_traits::BencodeTypeTraits<T>::Variant Parse(std::string_view data)
 {
-    auto [it, value] = details::Parse<T>(std::cbegin(data), std::cend(data));
+    auto [it, value] = details::Parse<T, Policy>(std::cbegin(data), std::cend(data));
     if (it != std::cend(data))
     {
-        throw std::runtime_error(
-            Format("Failed to parse bencode value: Unparsed data starts with {}: {}", std::distance(data.cbegin(), it), data));
+        throw std::runtime_error(Format(
+            "Failed to parse bencode value: Unparsed data starts with {}: {}", std::distance(data.cbegin(), it), Excerpt(it, data.cend())));
     }
 
     return value;
@@ -0,0 +1,210 @@
+#pragma once
+
+#include <bencode_encoder.h>
+#include <bencode_parser.h>
+
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+
+namespace converter::bencode {
+
+using PathItem = std::variant<std::string_view, size_t>;
+using Path = std::span<const PathItem>;
+
+namespace details {
+
+template <std::forward_iterator It>
+struct ValueLocation
+{
+    It Begin;
+    It End;
+    bool Found = false;
+};
+
+template <type_traits::BencodeTypeConcept T, std::forward_iterator It>
+ValueLocation<It> FindDictValue(It begin, It end, std::string_view key)
+{
+    using Traits = type_traits::BencodeTypeTraits<T>;
+
+    if (*begin != Traits::GetDictToken())
+    {
+        throw std::invalid_argument(Format("Expected dict for key '{}', actually: {}", key, *begin));
+    }
+
+    // The whole dict is walked so that an unsorted one is rejected instead of getting a duplicate key.
+    std::optional<ValueLocation<It>> location{};
+    std::optional<std::pair<It, It>> prevKey{};
+
+    auto it = std::next(begin);
+    while (it != end && *it != Traits::GetEndToken())
+    {
+        const auto [keyBegin, keyEnd] = ScanString<T>(it, end);
+        if (prevKey && !KeyLess(prevKey->first, prevKey->second, keyBegin, keyEnd))
+        {
+            throw std::invalid_argument(Format(
+                "The key '{}' is not greater than the previous key '{}'",
+                Excerpt(keyBegin, keyEnd),
+                Excerpt(prevKey->first, prevKey->second)));
+        }
+
+        prevKey.emplace(keyBegin, keyEnd);
+
+        const auto valueEnd = Skip<T>(keyEnd, end);
+        if (!location && std::equal(keyBegin, keyEnd, std::cbegin(key), std::cend(key)))
+        {
+            location = {keyEnd, valueEnd, true};
+        }
+        else if (!location && KeyLess(std::cbegin(key), std::cend(key), keyBegin, keyEnd))
+        {
+            location = {it, it, false};
+        }
+
+        it = valueEnd;
+    }
+
+    if (it == end)
+    {
+        throw std::invalid_argument("The dict ended unexpectedly");
+    }
+
+    return location.value_or(ValueLocation<It>{it, it, false});
+}
+
+template <type_traits::BencodeTypeConcept T, std::forward_iterator It>
+ValueLocation<It> FindListValue(It begin, It end, size_t index)
+{
+    using Traits = type_traits::BencodeTypeTraits<T>;
+
+    if (*begin != Traits::GetListToken())
+    {
+        throw std::invalid_argument(Format("Expected list for index {}, actually: {}", index, *begin));
+    }
+
+    auto it = std::next(begin);
+    for (size_t i = 0; it != end && *it != Traits::GetEndToken(); ++i)
+    {
+        auto valueEnd = Skip<T>(it, end);
+        if (i == index)
+        {
+            return {it, valueEnd, true};
+        }
+
+        it = valueEnd;
+    }
+
+    throw std::out_of_range(Format("The list index {} is out of range", index));
+}
+
+template <type_traits::BencodeTypeConcept T, std::forward_iterator It>
+ValueLocation<It> FindValue(It begin, It end, Path path)
+{
+    try
+    {
+        if (begin == end)
+        {
+            throw std::invalid_argument("The input value must not be empty.");
+        }
+
+        ValueLocation<It> location{begin, end, true};
+        for (auto item = std::cbegin(path); item != std::cend(path); ++item)
+        {
+            if (!location.Found)
+            {
+                throw std::out_of_range("The path refers to a missing dict key");
+            }
+
+            if (const auto* key = std::get_if<std::string_view>(&*item))
+            {
+                location = FindDictValue<T>(location.Begin, location.End, *key);
+            }
+            else
+            {
+                location = FindListValue<T>(location.Begin, location.End, std::get<size_t>(*item));
+            }
+        }
+
+        return location;
+    }
+    catch (...)
+    {
+        std::throw_with_nested(
+            std::runtime_error(Format("{}:{}:Failed to find Bencode value: {}", __FUNCTION__, __LINE__, Excerpt(begin, end))));
+    }
+}
+
+} // namespace details
+
+// Holds views into data, value and the path's last key, so all three must outlive the Patch.
+class Patch
+{
+public:
+    Patch(std::string_view data, Path path, std::string_view value)
+        : m_value(value)
+    {
+        if (details::Skip<BaseTypeView>(std::cbegin(data), std::cend(data)) != std::cend(data))
+        {
+            throw std::invalid_argument(
+                Format("Failed to patch bencode value: Expected a single bencode document: {}", Excerpt(data.begin(), data.end())));
+        }
+
+        if (details::Skip<BaseTypeView>(std::cbegin(value), std::cend(value)) != std::cend(value))
+        {
+            throw std::invalid_argument(
+                Format("Failed to patch bencode value: Expected a single bencode value: {}", Excerpt(value.begin(), value.end())));
+        }
+
+        const auto location = details::FindValue<BaseTypeView>(std::cbegin(data), std::cend(data), path);
+        m_prefix = std::string_view(std::cbegin(data), location.Begin);
+        m_suffix = std::string_view(location.End, std::cend(data));
+        if (!location.Found)
+        {
+            m_key = std::get<std::string_view>(path.back());
+        }
+    }
+
+    Patch(std::string_view data, std::initializer_list<PathItem> path, std::string_view value)
+        : Patch(data, Path{path.begin(), path.size()}, value)
+    {}
+
+    size_t Size() const noexcept
+    {
+        const size_t keySize = m_key ? fmt::formatted_size("{}:", m_key->size()) + m_key->size() : 0;
+        return m_prefix.size() + keySize + m_value.size() + m_suffix.size();
+    }
+
+    template <std::output_iterator<char> O>
+    O Write(O out) const
+    {
+        out = std::copy(std::cbegin(m_prefix), std::cend(m_prefix), out);
+        if (m_key)
+        {
+            out = details::EncodeString<BaseTypeView>(*m_key, out);
+        }
+
+        out = std::copy(std::cbegin(m_value), std::cend(m_value), out);
+        return std::copy(std::cbegin(m_suffix), std::cend(m_suffix), out);
+    }
+
+    std::string ToString() const
+    {
+        std::string result;
+        result.reserve(Size());
+        Write(std::back_inserter(result));
+
+        return result;
+    }
+private:
+    std::string_view m_prefix{};
+    std::optional<std::string_view> m_key{};
+    std::string_view m_value{};
+    std::string_view m_suffix{};
+};
+
+} // namespace converter::bencode
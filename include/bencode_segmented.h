@@ -0,0 +1,224 @@
+#pragma once
+
+#include <bencode_parser.h>
+
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <span>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+namespace converter::bencode {
+
+class SegmentIterator
+{
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = char;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const char*;
+    using reference = const char&;
+
+    SegmentIterator() = default;
+
+    SegmentIterator(std::span<const std::string_view> segments, size_t index, size_t offset)
+        : m_segments(segments)
+        , m_index(index)
+        , m_offset(offset)
+    {
+        SkipEmptySegments();
+    }
+
+    reference operator*() const noexcept
+    {
+        return m_segments[m_index][m_position];
+    }
+
+    SegmentIterator& operator++() noexcept
+    {
+        ++m_position;
+        ++m_offset;
+        SkipEmptySegments();
+
+        return *this;
+    }
+
+    SegmentIterator operator++(int) noexcept
+    {
+        auto result = *this;
+        ++*this;
+
+        return result;
+    }
+
+    std::string_view Segment() const noexcept
+    {
+        return m_index < m_segments.size() ? m_segments[m_index].substr(m_position) : std::string_view{};
+    }
+
+    void Advance(size_t count) noexcept
+    {
+        m_offset += count;
+        while (m_index < m_segments.size() && count >= m_segments[m_index].size() - m_position)
+        {
+            count -= m_segments[m_index].size() - m_position;
+            ++m_index;
+            m_position = 0;
+        }
+
+        m_position += count;
+        SkipEmptySegments();
+    }
+
+    bool operator==(const SegmentIterator& other) const noexcept
+    {
+        return m_offset == other.m_offset;
+    }
+
+    friend difference_type operator-(const SegmentIterator& lhs, const SegmentIterator& rhs) noexcept
+    {
+        return static_cast<difference_type>(lhs.m_offset) - static_cast<difference_type>(rhs.m_offset);
+    }
+private:
+    void SkipEmptySegments() noexcept
+    {
+        while (m_index < m_segments.size() && m_position == m_segments[m_index].size())
+        {
+            ++m_index;
+            m_position = 0;
+        }
+    }
+
+    std::span<const std::string_view> m_segments{};
+    size_t m_index{};
+    size_t m_position{};
+    size_t m_offset{};
+};
+
+class SegmentedBuffer
+{
+public:
+    explicit SegmentedBuffer(std::span<const std::string_view> segments)
+        : m_segments(segments)
+    {
+        for (const auto& segment : m_segments)
+        {
+            m_size += segment.size();
+        }
+    }
+
+    SegmentIterator begin() const noexcept
+    {
+        return {m_segments, 0, 0};
+    }
+
+    SegmentIterator end() const noexcept
+    {
+        return {m_segments, m_segments.size(), m_size};
+    }
+
+    size_t size() const noexcept
+    {
+        return m_size;
+    }
+private:
+    std::span<const std::string_view> m_segments{};
+    size_t m_size{};
+};
+
+class SegmentedString
+{
+public:
+    SegmentedString() = default;
+
+    SegmentedString(std::string_view value)
+        : m_value(value)
+    {}
+
+    SegmentedString(std::string value)
+        : m_value(std::move(value))
+    {}
+
+    template <std::forward_iterator It>
+    SegmentedString(It begin, It end)
+    {
+        if constexpr (std::contiguous_iterator<It>)
+        {
+            m_value = std::string_view(begin, end);
+        }
+        else if constexpr (type_traits::SegmentedIteratorConcept<It>)
+        {
+            const auto segment = begin.Segment();
+            const auto size = static_cast<size_t>(end - begin);
+            if (size <= segment.size())
+            {
+                m_value = segment.substr(0, size);
+            }
+            else
+            {
+                m_value = std::string(begin, end);
+            }
+        }
+        else
+        {
+            m_value = std::string(begin, end);
+        }
+    }
+
+    std::string_view View() const noexcept
+    {
+        return std::visit(
+            [](const auto& value) {
+                return std::string_view{value};
+            },
+            m_value);
+    }
+
+    operator std::string_view() const noexcept
+    {
+        return View();
+    }
+
+    bool IsView() const noexcept
+    {
+        return std::holds_alternative<std::string_view>(m_value);
+    }
+
+    size_t size() const noexcept
+    {
+        return View().size();
+    }
+
+    bool operator==(const SegmentedString& other) const noexcept
+    {
+        return View() == other.View();
+    }
+
+    std::strong_ordering operator<=>(const SegmentedString& other) const noexcept
+    {
+        return View() <=> other.View();
+    }
+private:
+    std::variant<std::string_view, std::string> m_value{};
+};
+
+using BaseTypeSegmented = details::BencodeType<int64_t, SegmentedString, std::vector, std::map>;
+using BenCodeVariantSegmented = type_traits::BencodeTypeTraits<BaseTypeSegmented>::Variant;
+
+template <type_traits::BencodeTypeConcept T, DictPolicy Policy = DictPolicy::Accept>
+type_traits::BencodeTypeTraits<T>::Variant Parse(const SegmentedBuffer& data)
+{
+    auto [it, value] = details::Parse<T, Policy>(data.begin(), data.end());
+    if (it != data.end())
+    {
+        throw std::runtime_error(Format(
+            "Failed to parse bencode value: Unparsed data starts with {}: {}", it - data.begin(), Excerpt(it, data.end())));
+    }
+
+    return value;
+}
+
+} // namespace converter::bencode
@@ -0,0 +1,181 @@
+#pragma once
+
+#include <bencode_parser.h>
+
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <string_view>
+#include <vector>
+
+namespace converter::bencode {
+
+class RecordIterator
+{
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::string_view;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const std::string_view*;
+    using reference = const std::string_view&;
+
+    RecordIterator() = default;
+
+    explicit RecordIterator(std::string_view data)
+        : m_data(data)
+    {
+        Next();
+    }
+
+    reference operator*() const noexcept
+    {
+        return m_record;
+    }
+
+    pointer operator->() const noexcept
+    {
+        return &m_record;
+    }
+
+    RecordIterator& operator++()
+    {
+        m_data.remove_prefix(m_record.size());
+        Next();
+
+        return *this;
+    }
+
+    RecordIterator operator++(int)
+    {
+        auto result = *this;
+        ++*this;
+
+        return result;
+    }
+
+    bool operator==(const RecordIterator& other) const noexcept
+    {
+        return m_record.data() == other.m_record.data() && m_record.size() == other.m_record.size();
+    }
+private:
+    void Next()
+    {
+        if (m_data.empty())
+        {
+            m_record = {};
+            return;
+        }
+
+        const auto endIt = details::Skip<BaseTypeView>(std::cbegin(m_data), std::cend(m_data));
+        m_record = std::string_view(std::cbegin(m_data), endIt);
+    }
+
+    std::string_view m_data{};
+    std::string_view m_record{};
+};
+
+// Move-only: the parsed value lives in the iterator and is never copied. The end is std::default_sentinel.
+template <type_traits::BencodeTypeConcept T, DictPolicy Policy = DictPolicy::Accept>
+class ValueIterator
+{
+public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = typename type_traits::BencodeTypeTraits<T>::Variant;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const value_type*;
+    using reference = const value_type&;
+
+    ValueIterator() = default;
+
+    explicit ValueIterator(std::string_view data)
+        : m_data(data)
+    {
+        Next();
+    }
+
+    ValueIterator(const ValueIterator&) = delete;
+    ValueIterator& operator=(const ValueIterator&) = delete;
+    ValueIterator(ValueIterator&&) noexcept = default;
+    ValueIterator& operator=(ValueIterator&&) noexcept = default;
+
+    reference operator*() const noexcept
+    {
+        return m_value;
+    }
+
+    pointer operator->() const noexcept
+    {
+        return &m_value;
+    }
+
+    std::string_view Record() const noexcept
+    {
+        return m_record;
+    }
+
+    ValueIterator& operator++()
+    {
+        m_data.remove_prefix(m_record.size());
+        Next();
+
+        return *this;
+    }
+
+    void operator++(int)
+    {
+        ++*this;
+    }
+
+    bool operator==(std::default_sentinel_t) const noexcept
+    {
+        return m_record.empty();
+    }
+private:
+    void Next()
+    {
+        if (m_data.empty())
+        {
+            m_record = {};
+            return;
+        }
+
+        auto [endIt, value] = details::Parse<T, Policy>(std::cbegin(m_data), std::cend(m_data));
+        m_record = std::string_view(std::cbegin(m_data), endIt);
+        m_value = std::move(value);
+    }
+
+    std::string_view m_data{};
+    std::string_view m_record{};
+    value_type m_value{};
+};
+
+inline std::ranges::subrange<RecordIterator> Records(std::string_view data)
+{
+    return {RecordIterator{data}, RecordIterator{}};
+}
+
+template <type_traits::BencodeTypeConcept T, DictPolicy Policy = DictPolicy::Accept>
+std::ranges::subrange<ValueIterator<T, Policy>, std::default_sentinel_t> ParseStream(std::string_view data)
+{
+    return {ValueIterator<T, Policy>{data}, std::default_sentinel};
+}
+
+inline std::vector<std::string_view> SplitBatches(std::string_view data, size_t batchSize)
+{
+    std::vector<std::string_view> batches;
+
+    auto batchBegin = std::cbegin(data);
+    for (auto it = batchBegin; it != std::cend(data);)
+    {
+        it = details::Skip<BaseTypeView>(it, std::cend(data));
+        if (static_cast<size_t>(std::distance(batchBegin, it)) >= batchSize || it == std::cend(data))
+        {
+            batches.emplace_back(batchBegin, it);
+            batchBegin = it;
+        }
+    }
+
+    return batches;
+}
+
+} // namespace converter::bencode
@@ -0,0 +1,295 @@
+#include <bencode_context.h>
+#include <bencode_hashed_dict.h>
+#include <bencode_parser.h>
+#include <bencode_patch.h>
+#include <config.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace bencode = converter::bencode;
+
+namespace {
+
+std::atomic<size_t> AllocationCount{0};
+
+constexpr size_t BaseScale = 1024;
+constexpr size_t ScaleFactor = 32;
+constexpr double MaxAllocationGrowth = ScaleFactor * 1.5;
+
+// CPU time is noisy, so it is only a loose check: linear growth is 32x, quadratic is 1024x.
+constexpr double MaxTimeGrowth = ScaleFactor * 8.0;
+constexpr std::clock_t MinMeasurableTime = CLOCKS_PER_SEC / 1000;
+
+struct Cost
+{
+    size_t Allocations{};
+    std::clock_t Time{};
+};
+
+template <typename Fn>
+Cost Measure(const std::string& input, Fn&& fn)
+{
+    constexpr int Runs = 9;
+
+    Cost cost{std::numeric_limits<size_t>::max(), std::numeric_limits<std::clock_t>::max()};
+    for (int i = 0; i < Runs; ++i)
+    {
+        const auto allocations = AllocationCount.load();
+        const auto start = std::clock();
+        try
+        {
+            fn(input);
+        }
+        catch (const std::exception&)
+        {
+        }
+
+        const auto time = std::clock() - start;
+        cost.Allocations = std::min(cost.Allocations, AllocationCount.load() - allocations);
+        cost.Time = std::min(cost.Time, time);
+    }
+
+    return cost;
+}
+
+void CheckLinearGrowth(const std::function<std::string(size_t)>& generate)
+{
+    const std::function<void(std::string_view)> parsers[] = {
+        [](std::string_view data) {
+            bencode::Parse<bencode::BaseType>(data);
+        },
+        [](std::string_view data) {
+            bencode::Parse<bencode::BaseTypeView>(data);
+        },
+        [](std::string_view data) {
+            bencode::Parse<bencode::BaseTypeView, bencode::DictPolicy::RejectUnsorted>(data);
+        },
+        [](std::string_view data) {
+            bencode::Parse<bencode::BaseTypeViewHashed>(data);
+        },
+        [](std::string_view data) {
+            bencode::Parse<bencode::BaseTypeViewHashed, bencode::DictPolicy::LastWins>(data);
+        },
+        [](std::string_view data) {
+            bencode::details::Skip<bencode::BaseTypeView>(std::cbegin(data), std::cend(data));
+        },
+        [parser = std::make_shared<bencode::Parser<>>()](std::string_view data) {
+            parser->Parse(data);
+        }};
+
+    const auto small = generate(BaseScale);
+    const auto large = generate(BaseScale * ScaleFactor);
+    const double sizeGrowth = static_cast<double>(large.size()) / small.size();
+
+    for (const auto& parser : parsers)
+    {
+        const auto smallCost = Measure(small, parser);
+        const auto largeCost = Measure(large, parser);
+
+        const double allocationGrowth = static_cast<double>(largeCost.Allocations) / std::max<size_t>(smallCost.Allocations, 1);
+        EXPECT_LE(allocationGrowth, MaxAllocationGrowth * sizeGrowth / ScaleFactor) << "Superlinear allocations: " << large.substr(0, 64);
+
+        const double timeGrowth = static_cast<double>(largeCost.Time) / std::max(smallCost.Time, MinMeasurableTime);
+        EXPECT_LE(timeGrowth, MaxTimeGrowth * sizeGrowth / ScaleFactor) << "Superlinear parse time: " << large.substr(0, 64);
+    }
+}
+
+// Every replaced new/delete form goes through this pair so the allocation counter sees them all.
+void* Allocate(size_t size)
+{
+    ++AllocationCount;
+    if (void* ptr = std::malloc(size))
+    {
+        return ptr;
+    }
+
+    throw std::bad_alloc();
+}
+
+void Deallocate(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+std::string Repeat(std::string_view value, size_t count, std::string_view prefix = {}, std::string_view suffix = {})
+{
+    std::string result;
+    result.reserve(prefix.size() + value.size() * count + suffix.size());
+    result += prefix;
+    for (size_t i = 0; i < count; ++i)
+    {
+        result += value;
+    }
+
+    result += suffix;
+    return result;
+}
+
+} // namespace
+
+void* operator new(size_t size)
+{
+    return Allocate(size);
+}
+
+void* operator new[](size_t size)
+{
+    return Allocate(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    Deallocate(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    Deallocate(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+    Deallocate(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept
+{
+    Deallocate(ptr);
+}
+
+TEST(BencodeComplexityTest, FlatList)
+{
+    CheckLinearGrowth([](size_t n) {
+        return Repeat("i123456e5:abcde", n, "l", "e");
+    });
+}
+
+TEST(BencodeComplexityTest, FlatDict)
+{
+    CheckLinearGrowth([](size_t n) {
+        std::string dict = "d";
+        for (size_t i = 0; i < n; ++i)
+        {
+            const auto key = fmt::format("{:08}", i);
+            dict += fmt::format("{}:{}i{}e", key.size(), key, i);
+        }
+
+        dict += "e";
+        return dict;
+    });
+}
+
+TEST(BencodeComplexityTest, DescendingDict)
+{
+    CheckLinearGrowth([](size_t n) {
+        std::string dict = "d";
+        for (size_t i = n; i-- != 0;)
+        {
+            const auto key = fmt::format("{:08}", i);
+            dict += fmt::format("{}:{}i{}e", key.size(), key, i);
+        }
+
+        dict += "e";
+        return dict;
+    });
+}
+
+TEST(BencodeComplexityTest, LongString)
+{
+    CheckLinearGrowth([](size_t n) {
+        const std::string payload(n * 64, 'x');
+        return fmt::format("{}:{}", payload.size(), payload);
+    });
+}
+
+TEST(BencodeComplexityTest, NestedLists)
+{
+    const auto nested = Repeat("li1e", bencode::MaxNestingDepth - 1, {}, Repeat("e", bencode::MaxNestingDepth - 1));
+    CheckLinearGrowth([&nested](size_t n) {
+        return Repeat(nested, n / 256 + 1, "l", "e");
+    });
+}
+
+TEST(BencodeComplexityTest, NestedDicts)
+{
+    const auto nested = Repeat("d1:ai1e1:b", bencode::MaxNestingDepth - 1, {}, Repeat("e", bencode::MaxNestingDepth - 1, "i0e"));
+    CheckLinearGrowth([&nested](size_t n) {
+        return Repeat(nested, n / 256 + 1, "l", "e");
+    });
+}
+
+TEST(BencodeComplexityTest, UnterminatedNesting)
+{
+    CheckLinearGrowth([](size_t n) {
+        return Repeat("d1:k", n, std::string(n, 'l'));
+    });
+}
+
+TEST(BencodeComplexityTest, ScaledCorpus)
+{
+    const std::filesystem::path CorpusPath{std::filesystem::path{test::config::ResourcesPath} / "corpus"};
+    ASSERT_TRUE(std::filesystem::is_directory(CorpusPath));
+
+    for (const auto& entry : std::filesystem::directory_iterator(CorpusPath))
+    {
+        std::ifstream file(entry.path(), std::ios_base::in | std::ios_base::binary);
+        const std::string seed{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+
+        SCOPED_TRACE(entry.path().filename().string());
+        CheckLinearGrowth([&seed](size_t n) {
+            return Repeat(seed, n / 64 + 1, "l", "e");
+        });
+    }
+}
+
+TEST(BencodeComplexityTest, ParserSteadyStateAllocations)
+{
+    const std::filesystem::path CorpusPath{std::filesystem::path{test::config::ResourcesPath} / "corpus"};
+
+    bencode::Parser parser;
+
+    // Rejected seeds are left out: building the error message allocates by design.
+    std::vector<std::string> documents;
+    for (const auto& entry : std::filesystem::directory_iterator(CorpusPath))
+    {
+        std::ifstream file(entry.path(), std::ios_base::in | std::ios_base::binary);
+        std::string document{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+        try
+        {
+            parser.Parse(document);
+            documents.push_back(std::move(document));
+        }
+        catch (const std::exception&)
+        {
+        }
+    }
+
+    for (const auto& document : documents)
+    {
+        parser.Parse(document);
+    }
+
+    const auto allocations = AllocationCount.load();
+    for (int i = 0; i < 100; ++i)
+    {
+        for (const auto& document : documents)
+        {
+            parser.Parse(document);
+        }
+    }
+
+    ASSERT_EQ(AllocationCount.load(), allocations);
+}
@@ -0,0 +1,98 @@
+#include <bencode_context.h>
+#include <bencode_encoder.h>
+
+#include <string>
+#include <string_view>
+
+#include <gtest/gtest.h>
+
+namespace bencode = converter::bencode;
+
+namespace {
+
+constexpr std::string_view TestDict = "d4:infod6:lengthi-12345e4:name10:sample.txte5:piecel3:abcli1eed0:i0eee7:privatei1ee";
+
+} // namespace
+
+TEST(BencodeContextTest, Parse)
+{
+    bencode::Parser parser;
+
+    const auto& value = parser.Parse(TestDict);
+    ASSERT_EQ(bencode::Encode<bencode::BaseTypeArena>(value), TestDict);
+
+    const auto& dict = std::get<bencode::BaseTypeArena::Dict>(value);
+    const auto privateIt = dict.find("private");
+    ASSERT_NE(privateIt, std::cend(dict));
+    ASSERT_EQ(std::get<bencode::BaseTypeArena::Int>(privateIt->second.AsVariant()), 1);
+}
+
+TEST(BencodeContextTest, ParseScalar)
+{
+    bencode::Parser parser;
+
+    ASSERT_EQ(std::get<bencode::BaseTypeArena::Int>(parser.Parse("i-42e")), -42);
+    ASSERT_EQ(std::get<bencode::BaseTypeArena::Str>(parser.Parse("5:hello")), "hello");
+    ASSERT_TRUE(std::get<bencode::BaseTypeArena::List>(parser.Parse("le")).empty());
+    ASSERT_TRUE(std::get<bencode::BaseTypeArena::Dict>(parser.Parse("de")).empty());
+}
+
+TEST(BencodeContextTest, ParseReusesArena)
+{
+    bencode::Parser parser{256};
+
+    for (int i = 0; i < 100; ++i)
+    {
+        const auto& value = parser.Parse(TestDict);
+        ASSERT_EQ(bencode::Encode<bencode::BaseTypeArena>(value), TestDict);
+    }
+}
+
+TEST(BencodeContextTest, ParseWhenInvalidParam)
+{
+    bencode::Parser parser;
+
+    for (std::string_view data : {"", "e", "i1", "i1ei2e", "l", "li1e", "d1:ae", "di1ei2ee", "d1:a", "5:abc", "x", "lee"})
+    {
+        ASSERT_ANY_THROW(parser.Parse(data)) << data;
+    }
+
+    ASSERT_EQ(bencode::Encode<bencode::BaseTypeArena>(parser.Parse(TestDict)), TestDict);
+}
+
+TEST(BencodeContextTest, ParseWhenNestingTooDeep)
+{
+    // The result tree is destroyed recursively on the next Parse, so its depth is bounded like details::Parse.
+    std::string data;
+    data.reserve(2 * 1024 * 1024);
+    data.append(1024 * 1024, 'l');
+    data.append(1024 * 1024, 'e');
+
+    bencode::Parser parser;
+    ASSERT_ANY_THROW(parser.Parse(data));
+
+    const auto deepest = std::string_view{data}.substr(data.size() / 2 - bencode::MaxNestingDepth, 2 * bencode::MaxNestingDepth);
+    ASSERT_EQ(bencode::Encode<bencode::BaseTypeArena>(parser.Parse(deepest)), deepest);
+    ASSERT_EQ(bencode::Encode<bencode::BaseTypeArena>(parser.Parse(TestDict)), TestDict);
+}
+
+TEST(BencodeContextTest, ParseWithDictPolicy)
+{
+    constexpr std::string_view Duplicates = "d1:ai1e1:ai2ee";
+    constexpr std::string_view Unsorted = "d1:bi1e1:ai2ee";
+
+    bencode::Parser accept;
+    ASSERT_EQ(bencode::Encode<bencode::BaseTypeArena>(accept.Parse(Duplicates)), "d1:ai1ee");
+
+    bencode::Parser<bencode::DictPolicy::LastWins> lastWins;
+    ASSERT_EQ(bencode::Encode<bencode::BaseTypeArena>(lastWins.Parse(Duplicates)), "d1:ai2ee");
+
+    bencode::Parser<bencode::DictPolicy::RejectDuplicates> rejectDuplicates;
+    ASSERT_ANY_THROW(rejectDuplicates.Parse(Duplicates));
+    ASSERT_EQ(bencode::Encode<bencode::BaseTypeArena>(rejectDuplicates.Parse(Unsorted)), "d1:ai2e1:bi1ee");
+
+    bencode::Parser<bencode::DictPolicy::RejectUnsorted> rejectUnsorted;
+    ASSERT_ANY_THROW(rejectUnsorted.Parse(Duplicates));
+    ASSERT_ANY_THROW(rejectUnsorted.Parse(Unsorted));
+    ASSERT_EQ(bencode::Encode<bencode::BaseTypeArena>(rejectUnsorted.Parse(TestDict)), TestDict);
+}
@@ -0,0 +1,96 @@
+#include <bencode_encoder.h>
+#include <bencode_hashed_dict.h>
+#include <bencode_parser.h>
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include <gtest/gtest.h>
+
+namespace bencode = converter::bencode;
+
+namespace {
+
+constexpr std::string_view TestQuery = "d1:ad2:id20:abcdefghij01234567899:info_hash20:mnopqrstuvwxyz123456e1:q9:get_peers1:t2:aa1:y1:qe";
+
+} // namespace
+
+TEST(BencodeHashedDictTest, Find)
+{
+    const auto value = bencode::Parse<bencode::BaseTypeViewHashed>(TestQuery);
+    const auto& dict = std::get<bencode::BaseTypeViewHashed::Dict>(value);
+
+    const auto typeIt = dict.Find("y");
+    ASSERT_NE(typeIt, std::cend(dict));
+    ASSERT_EQ(std::get<bencode::BaseTypeViewHashed::Str>(typeIt->second.AsVariant()), "q");
+    ASSERT_EQ(std::get<bencode::BaseTypeViewHashed::Str>(dict.Find("q")->second.AsVariant()), "get_peers");
+    ASSERT_EQ(dict.Find("r"), std::cend(dict));
+
+    const auto& args = std::get<bencode::BaseTypeViewHashed::Dict>(dict.Find("a")->second.AsVariant());
+    ASSERT_EQ(std::get<bencode::BaseTypeViewHashed::Str>(args.Find("info_hash")->second.AsVariant()), "mnopqrstuvwxyz123456");
+    ASSERT_EQ(args.Find("id"), args.find("id"));
+}
+
+TEST(BencodeHashedDictTest, KeyConstant)
+{
+    constexpr bencode::KeyConstant key = "info_hash";
+    static_assert(key.Hash == bencode::HashKey("info_hash"));
+    ASSERT_EQ(key.Key, "info_hash");
+}
+
+TEST(BencodeHashedDictTest, KeepsKeysSorted)
+{
+    bencode::BaseTypeViewHashed::Dict dict;
+    ASSERT_TRUE(dict.try_emplace("b", bencode::BenCodeVariantViewHashed{2}).second);
+    ASSERT_TRUE(dict.try_emplace("a", bencode::BenCodeVariantViewHashed{1}).second);
+    ASSERT_TRUE(dict.try_emplace("c", bencode::BenCodeVariantViewHashed{3}).second);
+    ASSERT_FALSE(dict.try_emplace("a", bencode::BenCodeVariantViewHashed{4}).second);
+    ASSERT_EQ(std::get<bencode::BaseTypeViewHashed::Int>(dict.find("a")->second.AsVariant()), 1);
+    ASSERT_EQ(std::get<bencode::BaseTypeViewHashed::Int>(dict.Find("c")->second.AsVariant()), 3);
+    static_assert(std::is_const_v<decltype(dict.begin()->first)>);
+
+    ASSERT_EQ(bencode::Encode<bencode::BaseTypeViewHashed>(bencode::BenCodeVariantViewHashed{std::move(dict)}), "d1:ai1e1:bi2e1:ci3ee");
+}
+
+TEST(BencodeHashedDictTest, DictPolicy)
+{
+    constexpr std::string_view TestDict = "d1:bi1e1:ai2e1:bi3ee";
+
+    const auto first = bencode::Parse<bencode::BaseTypeViewHashed>(TestDict);
+    const auto& firstDict = std::get<bencode::BaseTypeViewHashed::Dict>(first);
+    ASSERT_EQ(std::get<bencode::BaseTypeViewHashed::Int>(firstDict.Find("b")->second.AsVariant()), 1);
+
+    const auto last = bencode::Parse<bencode::BaseTypeViewHashed, bencode::DictPolicy::LastWins>(TestDict);
+    const auto& lastDict = std::get<bencode::BaseTypeViewHashed::Dict>(last);
+    ASSERT_EQ(std::get<bencode::BaseTypeViewHashed::Int>(lastDict.Find("b")->second.AsVariant()), 3);
+    ASSERT_EQ(bencode::Encode<bencode::BaseTypeViewHashed>(last), "d1:ai2e1:bi3ee");
+
+    ASSERT_ANY_THROW((bencode::Parse<bencode::BaseTypeViewHashed, bencode::DictPolicy::RejectDuplicates>(TestDict)));
+}
+
+TEST(BencodeHashedDictTest, LargeDict)
+{
+    std::string data = "d";
+    for (size_t i = 1000; i-- != 0;)
+    {
+        data += fmt::format("8:{:08}i{}e", i, i);
+    }
+
+    data += "8:00000500i0ee";
+
+    const auto value = bencode::Parse<bencode::BaseTypeViewHashed>(data);
+    const auto& dict = std::get<bencode::BaseTypeViewHashed::Dict>(value);
+    ASSERT_EQ(dict.size(), 1000);
+    ASSERT_TRUE(std::is_sorted(std::cbegin(dict), std::cend(dict), [](const auto& lhs, const auto& rhs) {
+        return lhs.first < rhs.first;
+    }));
+
+    ASSERT_EQ(std::get<bencode::BaseTypeViewHashed::Int>(dict.at("00000500").AsVariant()), 500);
+    ASSERT_EQ(std::get<bencode::BaseTypeViewHashed::Int>(dict.Find("00000999")->second.AsVariant()), 999);
+    ASSERT_FALSE(dict.contains("00001000"));
+
+    const auto expected = bencode::Encode<bencode::BaseTypeView>(bencode::Parse<bencode::BaseTypeView>(data));
+    ASSERT_EQ(bencode::Encode<bencode::BaseTypeViewHashed>(value), expected);
+}
@@ -63,6 +63,14 @@ TEST(BencodeParserTest, ParseInt)
     ASSERT_EQ(std::get<type_traits::BencodeTypeTraits<bencode::BaseType>::IntType>(variant), 9123);
 }
 
+TEST(BencodeParserTest, ParseNegativeInt)
+{
+    constexpr std::string_view TestInt = "i-9123e";
+    const auto [it, variant] = bencode::details::ParseInt<bencode::BaseType>(std::cbegin(TestInt), std::cend(TestInt));
+    ASSERT_EQ(it, std::cend(TestInt));
+    ASSERT_EQ(std::get<type_traits::BencodeTypeTraits<bencode::BaseType>::IntType>(variant), -9123);
+}
+
 TEST(BencodeParserTest, ParseIntWhenParamIsEmpty)
 {
     constexpr std::string_view TestInt = "";
@@ -92,6 +100,12 @@ TEST(BencodeParserTest, ParseIntWhenInvalidParam)
     constexpr std::string_view TestInt = "i9423ade";
     ASSERT_ANY_THROW(bencode::details::ParseInt<bencode::BaseType>(std::cbegin(TestInt), std::cend(TestInt)));
 
+    constexpr std::string_view TestIntWithPrefix = "ia9423e";
+    ASSERT_ANY_THROW(bencode::details::ParseInt<bencode::BaseType>(std::cbegin(TestIntWithPrefix), std::cend(TestIntWithPrefix)));
+
+    constexpr std::string_view TestIntWithoutDigits = "i-e";
+    ASSERT_ANY_THROW(bencode::details::ParseInt<bencode::BaseType>(std::cbegin(TestIntWithoutDigits), std::cend(TestIntWithoutDigits)));
+
     constexpr std::string_view TestStr = "12:Hello world!";
     ASSERT_ANY_THROW(bencode::details::ParseInt<bencode::BaseType>(std::cbegin(TestStr), std::cend(TestStr)));
 
@@ -102,6 +116,20 @@ TEST(BencodeParserTest, ParseIntWhenInvalidParam)
     ASSERT_ANY_THROW(bencode::details::ParseInt<bencode::BaseType>(std::cbegin(TestDict), std::cend(TestDict)));
 }
 
+TEST(BencodeParserTest, ParseIntWhenNonCanonical)
+{
+    for (const std::string_view data : {"i-0e", "i03e", "i-03e", "i00e"})
+    {
+        ASSERT_ANY_THROW(bencode::details::ParseInt<bencode::BaseType>(std::cbegin(data), std::cend(data))) << data;
+        ASSERT_ANY_THROW(bencode::details::Skip<bencode::BaseType>(std::cbegin(data), std::cend(data))) << data;
+    }
+
+    constexpr std::string_view TestZero = "i0e";
+    const auto [it, variant] = bencode::details::ParseInt<bencode::BaseType>(std::cbegin(TestZero), std::cend(TestZero));
+    ASSERT_EQ(it, std::cend(TestZero));
+    ASSERT_EQ(std::get<type_traits::BencodeTypeTraits<bencode::BaseType>::IntType>(variant), 0);
+}
+
 TEST(BencodeParserTest, ParseString)
 {
     constexpr std::string_view TestStr = "12:hello world!";
@@ -140,6 +168,14 @@ TEST(BencodeParserTest, ParseStringWhenPayloadCorrupted)
     ASSERT_ANY_THROW(bencode::details::ParseString<bencode::BaseType>(std::cbegin(PayloadLessExpected), std::cend(PayloadLessExpected)));
 }
 
+TEST(BencodeParserTest, ParseStringWhenSizeNonCanonical)
+{
+    constexpr std::string_view TestStr = "03:abc";
+    ASSERT_ANY_THROW(bencode::details::ParseString<bencode::BaseType>(std::cbegin(TestStr), std::cend(TestStr)));
+    ASSERT_ANY_THROW(bencode::Parse<bencode::BaseType>("d01:ai1ee"));
+    ASSERT_EQ(ParseString<bencode::BaseType>("0:"), "");
+}
+
 TEST(BencodeParserTest, ParseStringList)
 {
     constexpr std::string_view TestList = "l5:jelly4:cake7:custarde";
@@ -156,6 +192,15 @@ TEST(BencodeParserTest, ParseIntList)
     ASSERT_EQ((ParseHomogeneousList<bencode::BaseType, bencode::BaseType::Int>(TestList)), (std::vector<bencode::BaseType::Int>{1, 2, 3}));
 }
 
+TEST(BencodeParserTest, ParseListWithTrailingData)
+{
+    constexpr std::string_view TestList = "li1ei2eei3e";
+
+    const auto [it, value] = bencode::details::ParseList<bencode::BaseType>(std::cbegin(TestList), std::cend(TestList));
+    ASSERT_EQ(it, std::next(std::cbegin(TestList), 8));
+    ASSERT_EQ(std::get<bencode::BaseType::List>(value).size(), 2);
+}
+
 TEST(BencodeParserTest, ParseListWhenParamIsEmpty)
 {
     constexpr std::string_view TestList = "";
@@ -180,6 +225,31 @@ TEST(BencodeParserTest, ParseListWhenInvalidParam)
     ASSERT_ANY_THROW(bencode::details::ParseList<bencode::BaseType>(std::cbegin(TestList), std::cend(TestList)));
 }
 
+TEST(BencodeParserTest, ParseWhenNestingTooDeep)
+{
+    const auto nested = [](size_t depth) {
+        std::string data;
+        data.reserve(depth * 2);
+        data.append(depth, 'l');
+        data.append(depth, 'e');
+
+        return data;
+    };
+
+    const auto deepest = nested(bencode::MaxNestingDepth);
+    ASSERT_NO_THROW(bencode::Parse<bencode::BaseTypeView>(deepest));
+    ASSERT_EQ(bencode::details::Skip<bencode::BaseTypeView>(std::cbegin(deepest), std::cend(deepest)), std::cend(deepest));
+
+    const auto tooDeep = nested(bencode::MaxNestingDepth + 1);
+    ASSERT_ANY_THROW(bencode::Parse<bencode::BaseTypeView>(tooDeep));
+    ASSERT_ANY_THROW(bencode::details::Skip<bencode::BaseTypeView>(std::cbegin(tooDeep), std::cend(tooDeep)));
+
+    std::string unterminated = "d1:a";
+    unterminated.append(30000, 'l');
+    ASSERT_ANY_THROW(bencode::Parse<bencode::BaseType>(unterminated));
+    ASSERT_ANY_THROW(bencode::Parse<bencode::BaseTypeView>(std::string_view{unterminated}.substr(4)));
+}
+
 TEST(BencodeParserTest, ParseDict)
 {
     constexpr std::string_view TestDict = "d4:name5:cream5:pricei100ee";
@@ -191,6 +261,57 @@ TEST(BencodeParserTest, ParseDict)
     CheckDictItem(dict, "price", int64_t{100});
 }
 
+TEST(BencodeParserTest, ParseDictWithNestedList)
+{
+    constexpr std::string_view TestDict = "d4:listli1ei2ee4:name5:creame";
+
+    const auto [it, value] = bencode::details::ParseDict<bencode::BaseType>(std::cbegin(TestDict), std::cend(TestDict));
+    ASSERT_EQ(it, std::cend(TestDict));
+    auto dict = std::get<bencode::BaseType::Dict>(value);
+    CheckDictItem(dict, "name", std::string{"cream"});
+}
+
+TEST(BencodeParserTest, ParseDictWithDuplicateKeys)
+{
+    constexpr std::string_view TestDict = "d4:name5:cream4:name4:cake5:pricei100ee";
+
+    const auto [it, value] = bencode::details::ParseDict<bencode::BaseType>(std::cbegin(TestDict), std::cend(TestDict));
+    ASSERT_EQ(it, std::cend(TestDict));
+    auto dict = std::get<bencode::BaseType::Dict>(value);
+    CheckDictItem(dict, "name", std::string{"cream"});
+
+    const auto [lastIt, lastValue] =
+        bencode::details::ParseDict<bencode::BaseType, bencode::DictPolicy::LastWins>(std::cbegin(TestDict), std::cend(TestDict));
+    ASSERT_EQ(lastIt, std::cend(TestDict));
+    auto lastDict = std::get<bencode::BaseType::Dict>(lastValue);
+    CheckDictItem(lastDict, "name", std::string{"cake"});
+    CheckDictItem(lastDict, "price", int64_t{100});
+
+    ASSERT_ANY_THROW((bencode::Parse<bencode::BaseType, bencode::DictPolicy::RejectDuplicates>(TestDict)));
+    ASSERT_ANY_THROW((bencode::Parse<bencode::BaseType, bencode::DictPolicy::RejectUnsorted>(TestDict)));
+}
+
+TEST(BencodeParserTest, ParseDictWithUnsortedKeys)
+{
+    constexpr std::string_view TestDict = "d5:pricei100e4:name5:creame";
+
+    const auto [it, value] =
+        bencode::details::ParseDict<bencode::BaseType, bencode::DictPolicy::RejectDuplicates>(std::cbegin(TestDict), std::cend(TestDict));
+    ASSERT_EQ(it, std::cend(TestDict));
+
+    ASSERT_ANY_THROW(
+        (bencode::details::ParseDict<bencode::BaseType, bencode::DictPolicy::RejectUnsorted>(std::cbegin(TestDict), std::cend(TestDict))));
+    ASSERT_ANY_THROW((bencode::Parse<bencode::BaseTypeView, bencode::DictPolicy::RejectUnsorted>("ld1:ai1e1:bi2eed1:bi1e1:ai2eee")));
+}
+
+TEST(BencodeParserTest, ParseDictWithSortedKeys)
+{
+    constexpr std::string_view TestDict = "d0:i0e1:ai1e2:aai2e1:bi3e1:\xffi4ee";
+
+    const auto value = bencode::Parse<bencode::BaseTypeView, bencode::DictPolicy::RejectUnsorted>(TestDict);
+    ASSERT_EQ(std::get<bencode::BaseTypeView::Dict>(value).size(), 5);
+}
+
 TEST(BencodeParserTest, ParseDictWhenParamsIsEmpty)
 {
     constexpr std::string_view TestDict{};
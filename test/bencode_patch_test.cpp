@@ -0,0 +1,97 @@
+#include <bencode_encoder.h>
+#include <bencode_patch.h>
+
+#include <string>
+#include <string_view>
+
+#include <gtest/gtest.h>
+
+namespace bencode = converter::bencode;
+
+namespace {
+
+constexpr std::string_view TestTorrent = "d8:announce14:http://a/track4:infod6:lengthi42e4:name4:file6:piecesl3:abc3:defeee";
+
+} // namespace
+
+TEST(BencodePatchTest, Encode)
+{
+    constexpr std::string_view TestDict = "d4:infod1:ai2e1:b3:abce4:name5:cream5:pricei100ee";
+
+    ASSERT_EQ(bencode::Encode<bencode::BaseTypeView>(bencode::Parse<bencode::BaseTypeView>(TestDict)), TestDict);
+    ASSERT_EQ(bencode::Encode<bencode::BaseType>(bencode::BaseType::Str{"hello"}), "5:hello");
+    ASSERT_EQ(bencode::Encode<bencode::BaseType>(bencode::BaseType::Int{-7}), "i-7e");
+}
+
+TEST(BencodePatchTest, Skip)
+{
+    const auto it = bencode::details::Skip<bencode::BaseTypeView>(std::cbegin(TestTorrent), std::cend(TestTorrent));
+    ASSERT_EQ(it, std::cend(TestTorrent));
+
+    constexpr std::string_view TestList = "li1e3:abcei2e";
+    const auto listIt = bencode::details::Skip<bencode::BaseTypeView>(std::cbegin(TestList), std::cend(TestList));
+    ASSERT_EQ(listIt, std::next(std::cbegin(TestList), 10));
+}
+
+TEST(BencodePatchTest, SkipWhenInvalidParam)
+{
+    for (std::string_view data : {"", "e", "d3:abc", "li1e", "i12", "5:abc", "x", "d1:ae", "di1ei2ee", "d1:ad1:xe1:bi1ee"})
+    {
+        ASSERT_ANY_THROW(bencode::details::Skip<bencode::BaseTypeView>(std::cbegin(data), std::cend(data))) << data;
+    }
+}
+
+TEST(BencodePatchTest, PatchTopLevelKey)
+{
+    const bencode::Patch patch(TestTorrent, {"announce"}, "16:http://b/tracker");
+    ASSERT_EQ(patch.ToString(), "d8:announce16:http://b/tracker4:infod6:lengthi42e4:name4:file6:piecesl3:abc3:defeee");
+    ASSERT_EQ(patch.Size(), patch.ToString().size());
+}
+
+TEST(BencodePatchTest, PatchNestedValue)
+{
+    const bencode::Patch patch(TestTorrent, {"info", "pieces", size_t{1}}, "3:xyz");
+    ASSERT_EQ(patch.ToString(), "d8:announce14:http://a/track4:infod6:lengthi42e4:name4:file6:piecesl3:abc3:xyzeee");
+}
+
+TEST(BencodePatchTest, PatchInsertsMissingKeyInOrder)
+{
+    const bencode::Patch patch(TestTorrent, {"info", "private"}, "i1e");
+    const auto result = patch.ToString();
+    ASSERT_EQ(result, "d8:announce14:http://a/track4:infod6:lengthi42e4:name4:file6:piecesl3:abc3:defe7:privatei1eee");
+    ASSERT_EQ(patch.Size(), result.size());
+
+    const bencode::Patch first(TestTorrent, {"a"}, "i0e");
+    ASSERT_EQ(first.ToString().substr(0, 7), "d1:ai0e");
+}
+
+TEST(BencodePatchTest, PatchWriteToBuffer)
+{
+    const bencode::Patch patch(TestTorrent, {"info", "length"}, "i1024e");
+
+    std::string buffer(patch.Size(), '\0');
+    ASSERT_EQ(patch.Write(buffer.data()), buffer.data() + buffer.size());
+    ASSERT_EQ(buffer, "d8:announce14:http://a/track4:infod6:lengthi1024e4:name4:file6:piecesl3:abc3:defeee");
+}
+
+TEST(BencodePatchTest, PatchWhenInvalidParam)
+{
+    ASSERT_ANY_THROW(bencode::Patch(TestTorrent, {"announce"}, "i1"));
+    ASSERT_ANY_THROW(bencode::Patch(TestTorrent, {"announce"}, "i1ei2e"));
+    ASSERT_ANY_THROW(bencode::Patch(TestTorrent, {"missing", "key"}, "i1e"));
+    ASSERT_ANY_THROW(bencode::Patch(TestTorrent, {"announce", "key"}, "i1e"));
+    ASSERT_ANY_THROW(bencode::Patch(TestTorrent, {"info", "pieces", size_t{2}}, "i1e"));
+    ASSERT_ANY_THROW(bencode::Patch("d8:announce3:abc", {"comment"}, "i1e"));
+    ASSERT_ANY_THROW(bencode::Patch("dei5e", {"a"}, "i1e"));
+    ASSERT_ANY_THROW(bencode::Patch("d1:bi1ee1:", {"a"}, "i1e"));
+    ASSERT_ANY_THROW(bencode::Patch("d1:bi1e1:ai2ee", {"a"}, "i3e"));
+    ASSERT_ANY_THROW(bencode::Patch("d1:bi1e1:bi2ee", {"b"}, "i3e"));
+
+    for (std::string_view data : {"d1:ae", "di1ei2ee", "d1:ad1:xe1:bi1ee"})
+    {
+        ASSERT_ANY_THROW(bencode::Patch(data, {"b"}, "i1e")) << data;
+        ASSERT_ANY_THROW(bencode::Patch("d1:bi1ee", {"b"}, data)) << data;
+    }
+
+    ASSERT_ANY_THROW(bencode::Patch("d1:bi1edi1ei2eee", {"b"}, "i2e"));
+}
@@ -0,0 +1,113 @@
+#include <bencode_encoder.h>
+#include <bencode_segmented.h>
+
+#include <list>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace bencode = converter::bencode;
+
+namespace {
+
+constexpr std::string_view TestDict = "d4:infod6:lengthi-12345e4:name10:sample.txte5:piecel3:abc3:defe7:privatei1ee";
+
+} // namespace
+
+TEST(BencodeSegmentedTest, SegmentIterator)
+{
+    const std::vector<std::string_view> segments{"ab", "", "cde", "f"};
+    const bencode::SegmentedBuffer buffer{segments};
+
+    ASSERT_EQ(buffer.size(), 6);
+    ASSERT_EQ(std::string(buffer.begin(), buffer.end()), "abcdef");
+    ASSERT_EQ(buffer.end() - buffer.begin(), 6);
+
+    auto it = buffer.begin();
+    it.Advance(2);
+    ASSERT_EQ(*it, 'c');
+    ASSERT_EQ(it.Segment(), "cde");
+
+    it.Advance(3);
+    ASSERT_EQ(it.Segment(), "f");
+
+    it.Advance(1);
+    ASSERT_EQ(it, buffer.end());
+}
+
+TEST(BencodeSegmentedTest, FromCharsAcrossSegments)
+{
+    const std::vector<std::string_view> segments{"i12", "34", "5e"};
+    const bencode::SegmentedBuffer buffer{segments};
+
+    int64_t result{};
+    auto it = bencode::FromChars(std::next(buffer.begin()), buffer.end(), result);
+    ASSERT_EQ(result, 12345);
+    ASSERT_EQ(*it, 'e');
+
+    const std::vector<std::string_view> overflow{"99999999999", "999999999999"};
+    const bencode::SegmentedBuffer overflowBuffer{overflow};
+    ASSERT_THROW(bencode::FromChars(overflowBuffer.begin(), overflowBuffer.end(), result), std::system_error);
+}
+
+TEST(BencodeSegmentedTest, ParseAtEverySplit)
+{
+    for (size_t first = 0; first <= TestDict.size(); ++first)
+    {
+        for (size_t second = first; second <= TestDict.size(); second += 7)
+        {
+            const std::vector<std::string_view> segments{
+                TestDict.substr(0, first), TestDict.substr(first, second - first), TestDict.substr(second)};
+
+            const auto value = bencode::Parse<bencode::BaseTypeSegmented>(bencode::SegmentedBuffer{segments});
+            ASSERT_EQ(bencode::Encode<bencode::BaseTypeSegmented>(value), TestDict) << first << " " << second;
+
+            const auto copy = bencode::Parse<bencode::BaseType>(bencode::SegmentedBuffer{segments});
+            ASSERT_EQ(bencode::Encode<bencode::BaseType>(copy), TestDict) << first << " " << second;
+        }
+    }
+}
+
+TEST(BencodeSegmentedTest, ParseReturnsViewsWithinSegment)
+{
+    const std::vector<std::string_view> segments{"d4:name5:cr", "eam5:title4:cakee"};
+    const auto value = bencode::Parse<bencode::BaseTypeSegmented>(bencode::SegmentedBuffer{segments});
+    const auto& dict = std::get<bencode::BaseTypeSegmented::Dict>(value);
+
+    const auto name = dict.find(std::string_view{"name"});
+    ASSERT_NE(name, std::cend(dict));
+    ASSERT_TRUE(name->first.IsView());
+
+    const auto& cream = std::get<bencode::SegmentedString>(name->second.AsVariant());
+    ASSERT_EQ(cream.View(), "cream");
+    ASSERT_FALSE(cream.IsView());
+
+    const auto title = dict.find(std::string_view{"title"});
+    ASSERT_NE(title, std::cend(dict));
+    const auto& cake = std::get<bencode::SegmentedString>(title->second.AsVariant());
+    ASSERT_TRUE(cake.IsView());
+    ASSERT_EQ(cake.View().data(), segments[1].data() + 12);
+}
+
+TEST(BencodeSegmentedTest, ParseWhenInvalidParam)
+{
+    const std::vector<std::string_view> truncated{"d4:name5:cr", "ea"};
+    ASSERT_ANY_THROW(bencode::Parse<bencode::BaseTypeSegmented>(bencode::SegmentedBuffer{truncated}));
+
+    const std::vector<std::string_view> trailing{"i1", "ei2e"};
+    ASSERT_ANY_THROW(bencode::Parse<bencode::BaseTypeSegmented>(bencode::SegmentedBuffer{trailing}));
+}
+
+TEST(BencodeSegmentedTest, ParseFromForwardIterator)
+{
+    const std::list<char> data(std::cbegin(TestDict), std::cend(TestDict));
+
+    const auto [it, value] = bencode::details::Parse<bencode::BaseType>(std::cbegin(data), std::cend(data));
+    ASSERT_EQ(it, std::cend(data));
+    ASSERT_EQ(bencode::Encode<bencode::BaseType>(value), TestDict);
+
+    const std::list<char> truncated(std::cbegin(TestDict), std::prev(std::cend(TestDict)));
+    ASSERT_ANY_THROW(bencode::details::Parse<bencode::BaseType>(std::cbegin(truncated), std::cend(truncated)));
+}
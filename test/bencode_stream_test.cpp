@@ -0,0 +1,106 @@
+#include <bencode_stream.h>
+
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace bencode = converter::bencode;
+
+namespace {
+
+constexpr std::string_view TestStream = "d1:q4:ping1:y1:qei42e4:spamli1ei2eed1:y1:re";
+
+} // namespace
+
+TEST(BencodeStreamTest, Records)
+{
+    std::vector<std::string_view> records;
+    for (const auto record : bencode::Records(TestStream))
+    {
+        records.push_back(record);
+    }
+
+    ASSERT_EQ(records, (std::vector<std::string_view>{"d1:q4:ping1:y1:qe", "i42e", "4:spam", "li1ei2ee", "d1:y1:re"}));
+    ASSERT_EQ(records.front().data(), TestStream.data());
+}
+
+TEST(BencodeStreamTest, RecordsWhenParamIsEmpty)
+{
+    const auto records = bencode::Records({});
+    ASSERT_EQ(records.begin(), records.end());
+}
+
+TEST(BencodeStreamTest, RecordsWhenRecordIsTruncated)
+{
+    constexpr std::string_view TruncatedStream = "i1ei2";
+
+    auto it = bencode::RecordIterator{TruncatedStream};
+    ASSERT_EQ(*it, "i1e");
+    ASSERT_ANY_THROW(++it);
+}
+
+TEST(BencodeStreamTest, RecordsWhenDictIsMalformed)
+{
+    for (std::string_view data : {"d1:xei1e", "di1ei2eei1e", "d1:ad1:xe1:bi1eei1e"})
+    {
+        ASSERT_ANY_THROW(bencode::RecordIterator{data}) << data;
+        ASSERT_ANY_THROW(bencode::SplitBatches(data, 1)) << data;
+    }
+}
+
+TEST(BencodeStreamTest, ParseStream)
+{
+    std::vector<std::string_view> records;
+    std::vector<bencode::BenCodeVariantView> values;
+
+    auto stream = bencode::ParseStream<bencode::BaseTypeView>(TestStream);
+    for (auto it = stream.begin(); it != stream.end(); ++it)
+    {
+        records.push_back(it.Record());
+        values.push_back(*it);
+    }
+
+    ASSERT_EQ(records.size(), 5);
+    ASSERT_EQ(records[3], "li1ei2ee");
+    ASSERT_EQ(std::get<bencode::BaseTypeView::Int>(values[1]), 42);
+    ASSERT_EQ(std::get<bencode::BaseTypeView::Str>(values[2]), "spam");
+    ASSERT_EQ(std::get<bencode::BaseTypeView::Str>(values[2]).data(), TestStream.data() + 23);
+    ASSERT_EQ(std::get<bencode::BaseTypeView::List>(values[3]).size(), 2);
+}
+
+TEST(BencodeStreamTest, ParseStreamIsMoveOnly)
+{
+    using Iterator = bencode::ValueIterator<bencode::BaseTypeView>;
+    static_assert(std::input_iterator<Iterator>);
+    static_assert(!std::copyable<Iterator>);
+    static_assert(std::ranges::input_range<decltype(bencode::ParseStream<bencode::BaseTypeView>({}))>);
+
+    size_t count{};
+    for (const auto& value : bencode::ParseStream<bencode::BaseTypeView>(TestStream))
+    {
+        count += std::holds_alternative<bencode::BaseTypeView::Dict>(value);
+    }
+
+    ASSERT_EQ(count, 2);
+    ASSERT_TRUE(bencode::ParseStream<bencode::BaseTypeView>({}).empty());
+}
+
+TEST(BencodeStreamTest, ParseStreamWhenInvalidParam)
+{
+    constexpr std::string_view InvalidStream = "i1ex";
+    ASSERT_ANY_THROW(for (const auto& value : bencode::ParseStream<bencode::BaseType>(InvalidStream)) { (void)value; });
+}
+
+TEST(BencodeStreamTest, SplitBatches)
+{
+    const auto batches = bencode::SplitBatches(TestStream, 11);
+    ASSERT_EQ(batches, (std::vector<std::string_view>{"d1:q4:ping1:y1:qe", "i42e4:spamli1ei2ee", "d1:y1:re"}));
+
+    ASSERT_EQ(bencode::SplitBatches(TestStream, 0).size(), 5);
+    ASSERT_EQ(bencode::SplitBatches(TestStream, TestStream.size()), (std::vector<std::string_view>{TestStream}));
+    ASSERT_TRUE(bencode::SplitBatches({}, 10).empty());
+}